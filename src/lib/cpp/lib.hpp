@@ -9,12 +9,16 @@
 #include "./literal.hpp"
 
 #include <compare>
+#include <concepts>
 #include <expected>
 #include <ios>
 #include <iostream>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace std {
@@ -95,6 +99,20 @@ constexpr const auto bin_flag = std::ios_base::oct;
 constexpr const auto add_gaps_flag = std::ios_base::showpoint;
 constexpr const auto trim_first_number_flag = std::ios_base::skipws;
 } // namespace bigint_ios
+
+// the other native integers (like int literals) would be ambiguous between the uint64_t and the
+// int64_t overloads, so they are forwarded to the one with the same signedness
+template <typename T>
+concept BigIntOtherIntegral = std::integral<T> && !std::same_as<T, bool> &&
+                              !std::same_as<T, uint64_t> && !std::same_as<T, int64_t>;
+
+template <BigIntOtherIntegral T> [[nodiscard]] constexpr auto bigint_native_value(T value) {
+	if constexpr(std::is_signed_v<T>) {
+		return static_cast<int64_t>(value);
+	} else {
+		return static_cast<uint64_t>(value);
+	}
+}
 } // namespace
 
 struct BigInt {
@@ -187,17 +205,177 @@ struct BigInt {
 
 	[[nodiscard]] bool operator<(const BigInt& value2) const;
 
+	// the comparisons with native numbers don't need a temporary BigInt, the other comparison
+	// operators are rewritten to these
+
+	[[nodiscard]] std::strong_ordering operator<=>(uint64_t value2) const;
+
+	[[nodiscard]] std::strong_ordering operator<=>(int64_t value2) const;
+
+	[[nodiscard]] bool operator==(uint64_t value2) const;
+
+	[[nodiscard]] bool operator==(int64_t value2) const;
+
+	template <BigIntOtherIntegral T>
+	[[nodiscard]] std::strong_ordering operator<=>(T value2) const {
+		return *this <=> bigint_native_value(value2);
+	}
+
+	template <BigIntOtherIntegral T> [[nodiscard]] bool operator==(T value2) const {
+		return *this == bigint_native_value(value2);
+	}
+
 	[[nodiscard]] BigInt operator+(const BigInt& value2) const;
 
 	[[nodiscard]] BigInt operator-(const BigInt& value2) const;
 
 	[[nodiscard]] BigInt operator*(const BigInt& value2) const;
 
-	[[nodiscard]] bool operator/(const BigInt& value2) const;
+	// the arithmetic with native numbers doesn't need a temporary BigInt
+
+	[[nodiscard]] BigInt operator+(uint64_t value2) const;
+
+	[[nodiscard]] BigInt operator+(int64_t value2) const;
+
+	[[nodiscard]] BigInt operator-(uint64_t value2) const;
+
+	[[nodiscard]] BigInt operator-(int64_t value2) const;
+
+	[[nodiscard]] BigInt operator*(uint64_t value2) const;
+
+	[[nodiscard]] BigInt operator*(int64_t value2) const;
+
+	template <BigIntOtherIntegral T> [[nodiscard]] BigInt operator+(T value2) const {
+		return *this + bigint_native_value(value2);
+	}
+
+	template <BigIntOtherIntegral T> [[nodiscard]] BigInt operator-(T value2) const {
+		return *this - bigint_native_value(value2);
+	}
+
+	template <BigIntOtherIntegral T> [[nodiscard]] BigInt operator*(T value2) const {
+		return *this * bigint_native_value(value2);
+	}
+
+	/**
+	 * @brief The truncated quotient (rounded towards 0), like for native numbers
+	 * @throws std::domain_error - when value2 is 0
+	 */
+	[[nodiscard]] BigInt operator/(const BigInt& value2) const;
+
+	/**
+	 * @brief The remainder of the truncated division, it has the sign of this
+	 * @throws std::domain_error - when value2 is 0
+	 */
+	[[nodiscard]] BigInt operator%(const BigInt& value2) const;
+
+	/**
+	 * @brief The truncated quotient and the remainder, this is faster than using / and %
+	 * @throws std::domain_error - when value2 is 0
+	 */
+	[[nodiscard]] std::pair<BigInt, BigInt> divmod(const BigInt& value2) const;
+
+	/**
+	 * @brief The floored quotient (rounded towards negative infinity) and the remainder, that has
+	 * the sign of value2
+	 * @throws std::domain_error - when value2 is 0
+	 */
+	[[nodiscard]] std::pair<BigInt, BigInt> divmod_floor(const BigInt& value2) const;
+
+	/**
+	 * @brief The reciprocal 2^bits / *this, truncated towards zero, see bigint_reciprocal
+	 * @throws std::domain_error - when *this is 0
+	 */
+	[[nodiscard]] BigInt reciprocal(std::size_t bits) const;
 
-	[[nodiscard]] bool operator%(const BigInt& value2) const;
+	/**
+	 * @brief The quotient, if the division is known to be exact, see bigint_divexact
+	 * @throws std::domain_error - when value2 is 0
+	 */
+	[[nodiscard]] BigInt divexact(const BigInt& value2) const;
 
-	[[nodiscard]] bool operator^(const BigInt& value2) const;
+	[[nodiscard]] BigInt divexact(uint64_t value2) const;
+
+	/**
+	 * @brief The power *this^exponent, 0^0 is 1, see bigint_pow_u64
+	 */
+	[[nodiscard]] BigInt pow(uint64_t exponent) const;
+
+	/**
+	 * @brief The power *this^exponent mod modulus, the result is in [0, |modulus|), see
+	 * bigint_powm
+	 * @throws std::domain_error - when the modulus is 0 or the exponent is negative
+	 */
+	[[nodiscard]] BigInt powm(const BigInt& exponent, const BigInt& modulus) const;
+
+	/**
+	 * @brief The greatest common divisor of the absolute values, see bigint_gcd
+	 */
+	[[nodiscard]] BigInt gcd(const BigInt& value2) const;
+
+	/**
+	 * @brief The gcd and the factors of gcd = *this * factor1 + value2 * factor2, see
+	 * bigint_gcdext
+	 */
+	[[nodiscard]] std::tuple<BigInt, BigInt, BigInt> gcdext(const BigInt& value2) const;
+
+	/**
+	 * @brief The modular inverse in [0, |modulus|), if it exists, see bigint_invert
+	 * @throws std::domain_error - when the modulus is 0
+	 */
+	[[nodiscard]] std::optional<BigInt> invert(const BigInt& modulus) const;
+
+	/**
+	 * @brief The integer square root and the remainder, see bigint_sqrtrem
+	 * @throws std::domain_error - when *this is negative
+	 */
+	[[nodiscard]] std::pair<BigInt, BigInt> sqrtrem() const;
+
+	/**
+	 * @brief The integer root, rounded towards 0, and the remainder, see bigint_rootrem
+	 * @throws std::domain_error - when the degree is 0 or even and *this is negative
+	 */
+	[[nodiscard]] std::pair<BigInt, BigInt> rootrem(uint64_t degree) const;
+
+	/**
+	 * @brief If this is a probable prime, see bigint_is_probable_prime
+	 */
+	[[nodiscard]] bool is_probable_prime(size_t rounds = 0) const;
+
+	/**
+	 * @brief The smallest probable prime, that is bigger than *this, see bigint_next_prime
+	 */
+	[[nodiscard]] BigInt next_prime(size_t threads = 1) const;
+
+	/**
+	 * @brief The factorial number!, see bigint_factorial
+	 */
+	[[nodiscard]] static BigInt factorial(uint64_t number);
+
+	/**
+	 * @brief The binomial coefficient number choose count, see bigint_binomial
+	 */
+	[[nodiscard]] static BigInt binomial(uint64_t number, uint64_t count);
+
+	/**
+	 * @brief The product of all primes <= number, see bigint_primorial
+	 */
+	[[nodiscard]] static BigInt primorial(uint64_t number);
+
+	/**
+	 * @brief The bitwise and, negative numbers behave like two's complement with infinitely many
+	 * bits
+	 */
+	[[nodiscard]] BigInt operator&(const BigInt& value2) const;
+
+	[[nodiscard]] BigInt operator|(const BigInt& value2) const;
+
+	[[nodiscard]] BigInt operator^(const BigInt& value2) const;
+
+	/**
+	 * @brief The bitwise complement, this is -*this - 1
+	 */
+	[[nodiscard]] BigInt operator~() const;
 
 	[[nodiscard]] BigInt& operator-();
 
@@ -207,19 +385,68 @@ struct BigInt {
 
 	[[nodiscard]] BigInt& operator*=(const BigInt& value2);
 
+	[[nodiscard]] BigInt& operator+=(uint64_t value2);
+
+	[[nodiscard]] BigInt& operator+=(int64_t value2);
+
+	[[nodiscard]] BigInt& operator-=(uint64_t value2);
+
+	[[nodiscard]] BigInt& operator-=(int64_t value2);
+
+	[[nodiscard]] BigInt& operator*=(uint64_t value2);
+
+	[[nodiscard]] BigInt& operator*=(int64_t value2);
+
+	template <BigIntOtherIntegral T> [[nodiscard]] BigInt& operator+=(T value2) {
+		return *this += bigint_native_value(value2);
+	}
+
+	template <BigIntOtherIntegral T> [[nodiscard]] BigInt& operator-=(T value2) {
+		return *this -= bigint_native_value(value2);
+	}
+
+	template <BigIntOtherIntegral T> [[nodiscard]] BigInt& operator*=(T value2) {
+		return *this *= bigint_native_value(value2);
+	}
+
 	[[nodiscard]] BigInt& operator/=(const BigInt& value2);
 
-	[[nodiscard]] BigInt& operator%=(const BigInt& value2) const;
+	[[nodiscard]] BigInt& operator%=(const BigInt& value2);
+
+	[[nodiscard]] BigInt& operator&=(const BigInt& value2);
 
-	[[nodiscard]] BigInt& operator^=(const BigInt& value2) const;
+	[[nodiscard]] BigInt& operator|=(const BigInt& value2);
 
-	[[nodiscard]] BigInt operator<<(const BigInt& value2) const;
+	[[nodiscard]] BigInt& operator^=(const BigInt& value2);
 
-	[[nodiscard]] BigInt operator>>(const BigInt& value2) const;
+	[[nodiscard]] BigInt operator<<(std::size_t amount) const;
+
+	/**
+	 * @brief The arithmetic right shift, negative numbers are rounded towards negative infinity
+	 */
+	[[nodiscard]] BigInt operator>>(std::size_t amount) const;
 
-	[[nodiscard]] BigInt& operator>>=(const BigInt& value2);
+	[[nodiscard]] BigInt& operator>>=(std::size_t amount);
 
-	[[nodiscard]] BigInt& operator<<=(const BigInt& value2);
+	[[nodiscard]] BigInt& operator<<=(std::size_t amount);
+
+	/**
+	 * @brief The bit length of the absolute value, see bigint_bit_length
+	 */
+	[[nodiscard]] std::size_t bit_length() const;
+
+	[[nodiscard]] std::size_t popcount() const;
+
+	[[nodiscard]] std::size_t ctz() const;
+
+	/**
+	 * @brief The bit at index, negative numbers use two's complement, see bigint_test_bit
+	 */
+	[[nodiscard]] bool test_bit(std::size_t index) const;
+
+	void set_bit(std::size_t index);
+
+	void clear_bit(std::size_t index);
 
 	[[nodiscard]] BigInt& operator++();
 
@@ -414,6 +641,34 @@ BigInt& BigInt::operator=(BigInt&& big_int) noexcept {
 	return (*this <=> value2) < 0;
 }
 
+[[nodiscard]] std::strong_ordering BigInt::operator<=>(uint64_t value2) const {
+	int8_t value = bigint_cmp_u64(this->m_c_value, value2);
+
+	if(value == 0) {
+		return std::strong_ordering::equal;
+	}
+
+	return value > 0 ? std::strong_ordering::greater : std::strong_ordering::less;
+}
+
+[[nodiscard]] std::strong_ordering BigInt::operator<=>(int64_t value2) const {
+	int8_t value = bigint_cmp_i64(this->m_c_value, value2);
+
+	if(value == 0) {
+		return std::strong_ordering::equal;
+	}
+
+	return value > 0 ? std::strong_ordering::greater : std::strong_ordering::less;
+}
+
+[[nodiscard]] bool BigInt::operator==(uint64_t value2) const {
+	return bigint_eq_u64(this->m_c_value, value2);
+}
+
+[[nodiscard]] bool BigInt::operator==(int64_t value2) const {
+	return bigint_eq_i64(this->m_c_value, value2);
+}
+
 [[nodiscard]] BigInt BigInt::operator+(const BigInt& value2) const {
 
 	BigIntC result = bigint_add_bigint(this->m_c_value, value2.m_c_value);
@@ -428,27 +683,237 @@ BigInt& BigInt::operator=(BigInt&& big_int) noexcept {
 }
 
 [[nodiscard]] BigInt BigInt::operator*(const BigInt& value2) const {
+	if(this == &value2) {
+		// x * x, use the faster squaring
+		BigIntC result = bigint_sqr(this->m_c_value);
+
+		return BigInt{ std::move(result) };
+	}
+
 	BigIntC result = bigint_mul_bigint(this->m_c_value, value2.m_c_value);
 
 	return BigInt{ std::move(result) };
 }
 
-[[nodiscard]] bool BigInt::operator/(const BigInt& value2) const {
-	// TODO
-	UNUSED(value2);
-	throw std::runtime_error("TODO");
+[[nodiscard]] BigInt BigInt::operator+(uint64_t value2) const {
+	BigIntC result = bigint_add_u64(this->m_c_value, value2);
+
+	return BigInt{ std::move(result) };
 }
 
-[[nodiscard]] bool BigInt::operator%(const BigInt& value2) const {
-	// TODO
-	UNUSED(value2);
-	throw std::runtime_error("TODO");
+[[nodiscard]] BigInt BigInt::operator+(int64_t value2) const {
+	BigIntC result = bigint_add_i64(this->m_c_value, value2);
+
+	return BigInt{ std::move(result) };
 }
 
-[[nodiscard]] bool BigInt::operator^(const BigInt& value2) const {
-	// TODO
-	UNUSED(value2);
-	throw std::runtime_error("TODO");
+[[nodiscard]] BigInt BigInt::operator-(uint64_t value2) const {
+	BigIntC result = bigint_sub_u64(this->m_c_value, value2);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::operator-(int64_t value2) const {
+	BigIntC result = bigint_sub_i64(this->m_c_value, value2);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::operator*(uint64_t value2) const {
+	BigIntC result = bigint_mul_u64(this->m_c_value, value2);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::operator*(int64_t value2) const {
+	BigIntC result = bigint_mul_i64(this->m_c_value, value2);
+
+	return BigInt{ std::move(result) };
+}
+
+namespace { // NOLINT(cert-dcl59-cpp,google-build-namespaces)
+void bigint_check_divisor(const BigIntC& divisor) {
+	if(bigint_eq_u64(divisor, 0ULL)) {
+		throw std::domain_error("division by zero");
+	}
+}
+} // namespace
+
+[[nodiscard]] BigInt BigInt::operator/(const BigInt& value2) const {
+	bigint_check_divisor(value2.m_c_value);
+
+	BigIntC result = bigint_div(this->m_c_value, value2.m_c_value);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::operator%(const BigInt& value2) const {
+	bigint_check_divisor(value2.m_c_value);
+
+	BigIntC result = bigint_mod(this->m_c_value, value2.m_c_value);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] std::pair<BigInt, BigInt> BigInt::divmod(const BigInt& value2) const {
+	bigint_check_divisor(value2.m_c_value);
+
+	BigIntDivModC result = bigint_divmod(this->m_c_value, value2.m_c_value);
+
+	return { BigInt{ std::move(result.quotient) }, BigInt{ std::move(result.remainder) } };
+}
+
+[[nodiscard]] std::pair<BigInt, BigInt> BigInt::divmod_floor(const BigInt& value2) const {
+	bigint_check_divisor(value2.m_c_value);
+
+	BigIntDivModC result = bigint_divmod_floor(this->m_c_value, value2.m_c_value);
+
+	return { BigInt{ std::move(result.quotient) }, BigInt{ std::move(result.remainder) } };
+}
+
+[[nodiscard]] BigInt BigInt::reciprocal(std::size_t bits) const {
+	bigint_check_divisor(this->m_c_value);
+
+	BigIntC result = bigint_reciprocal(this->m_c_value, bits);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::divexact(const BigInt& value2) const {
+	bigint_check_divisor(value2.m_c_value);
+
+	BigIntC result = bigint_divexact(this->m_c_value, value2.m_c_value);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::divexact(uint64_t value2) const {
+	if(value2 == 0) {
+		throw std::domain_error("division by zero");
+	}
+
+	BigIntC result = bigint_divexact_u64(this->m_c_value, value2);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::pow(uint64_t exponent) const {
+	BigIntC result = bigint_pow_u64(this->m_c_value, exponent);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::powm(const BigInt& exponent, const BigInt& modulus) const {
+	bigint_check_divisor(modulus.m_c_value);
+
+	if(!exponent.m_c_value.positive) {
+		throw std::domain_error("negative exponent");
+	}
+
+	BigIntC result = bigint_powm(this->m_c_value, exponent.m_c_value, modulus.m_c_value);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::gcd(const BigInt& value2) const {
+	BigIntC result = bigint_gcd(this->m_c_value, value2.m_c_value);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] std::tuple<BigInt, BigInt, BigInt> BigInt::gcdext(const BigInt& value2) const {
+	BigIntGcdExtC result = bigint_gcdext(this->m_c_value, value2.m_c_value);
+
+	return { BigInt{ std::move(result.gcd) }, BigInt{ std::move(result.factor1) },
+		     BigInt{ std::move(result.factor2) } };
+}
+
+[[nodiscard]] std::optional<BigInt> BigInt::invert(const BigInt& modulus) const {
+	bigint_check_divisor(modulus.m_c_value);
+
+	BigIntC result{};
+
+	if(!bigint_invert(&result, this->m_c_value, modulus.m_c_value)) {
+		return std::nullopt;
+	}
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] std::pair<BigInt, BigInt> BigInt::sqrtrem() const {
+	if(!this->m_c_value.positive) {
+		throw std::domain_error("square root of a negative number");
+	}
+
+	BigIntRootRemC result = bigint_sqrtrem(this->m_c_value);
+
+	return { BigInt{ std::move(result.root) }, BigInt{ std::move(result.remainder) } };
+}
+
+[[nodiscard]] std::pair<BigInt, BigInt> BigInt::rootrem(uint64_t degree) const {
+	if(degree == 0) {
+		throw std::domain_error("root of degree 0");
+	}
+
+	if(!this->m_c_value.positive && (degree & 0x01) == 0) {
+		throw std::domain_error("even root of a negative number");
+	}
+
+	BigIntRootRemC result = bigint_rootrem(this->m_c_value, degree);
+
+	return { BigInt{ std::move(result.root) }, BigInt{ std::move(result.remainder) } };
+}
+
+[[nodiscard]] bool BigInt::is_probable_prime(size_t rounds) const {
+	return bigint_is_probable_prime(this->m_c_value, rounds);
+}
+
+[[nodiscard]] BigInt BigInt::next_prime(size_t threads) const {
+	BigIntC result = bigint_next_prime(this->m_c_value, threads);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::factorial(uint64_t number) {
+	BigIntC result = bigint_factorial(number);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::binomial(uint64_t number, uint64_t count) {
+	BigIntC result = bigint_binomial(number, count);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::primorial(uint64_t number) {
+	BigIntC result = bigint_primorial(number);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::operator&(const BigInt& value2) const {
+	BigIntC result = bigint_and(this->m_c_value, value2.m_c_value);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::operator|(const BigInt& value2) const {
+	BigIntC result = bigint_or(this->m_c_value, value2.m_c_value);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::operator^(const BigInt& value2) const {
+	BigIntC result = bigint_xor(this->m_c_value, value2.m_c_value);
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt BigInt::operator~() const {
+	BigIntC result = bigint_not(this->m_c_value);
+
+	return BigInt{ std::move(result) };
 }
 
 [[nodiscard]] BigInt& BigInt::operator-() {
@@ -477,7 +942,68 @@ BigInt& BigInt::operator=(BigInt&& big_int) noexcept {
 }
 
 [[nodiscard]] BigInt& BigInt::operator*=(const BigInt& value2) {
-	BigIntC result = bigint_mul_bigint(this->m_c_value, value2.m_c_value);
+	BigIntC result = this == &value2 ? bigint_sqr(this->m_c_value)
+	                                 : bigint_mul_bigint(this->m_c_value, value2.m_c_value);
+
+	free_bigint(&(this->m_c_value));
+
+	this->m_c_value = result;
+
+	return *this;
+}
+
+[[nodiscard]] BigInt& BigInt::operator+=(uint64_t value2) {
+	BigIntC result = bigint_add_u64(this->m_c_value, value2);
+
+	free_bigint(&(this->m_c_value));
+
+	this->m_c_value = result;
+
+	return *this;
+}
+
+[[nodiscard]] BigInt& BigInt::operator+=(int64_t value2) {
+	BigIntC result = bigint_add_i64(this->m_c_value, value2);
+
+	free_bigint(&(this->m_c_value));
+
+	this->m_c_value = result;
+
+	return *this;
+}
+
+[[nodiscard]] BigInt& BigInt::operator-=(uint64_t value2) {
+	BigIntC result = bigint_sub_u64(this->m_c_value, value2);
+
+	free_bigint(&(this->m_c_value));
+
+	this->m_c_value = result;
+
+	return *this;
+}
+
+[[nodiscard]] BigInt& BigInt::operator-=(int64_t value2) {
+	BigIntC result = bigint_sub_i64(this->m_c_value, value2);
+
+	free_bigint(&(this->m_c_value));
+
+	this->m_c_value = result;
+
+	return *this;
+}
+
+[[nodiscard]] BigInt& BigInt::operator*=(uint64_t value2) {
+	BigIntC result = bigint_mul_u64(this->m_c_value, value2);
+
+	free_bigint(&(this->m_c_value));
+
+	this->m_c_value = result;
+
+	return *this;
+}
+
+[[nodiscard]] BigInt& BigInt::operator*=(int64_t value2) {
+	BigIntC result = bigint_mul_i64(this->m_c_value, value2);
 
 	free_bigint(&(this->m_c_value));
 
@@ -487,21 +1013,57 @@ BigInt& BigInt::operator=(BigInt&& big_int) noexcept {
 }
 
 [[nodiscard]] BigInt& BigInt::operator/=(const BigInt& value2) {
-	// TODO
-	UNUSED(value2);
-	throw std::runtime_error("TODO");
+	bigint_check_divisor(value2.m_c_value);
+
+	BigIntC result = bigint_div(this->m_c_value, value2.m_c_value);
+
+	free_bigint(&(this->m_c_value));
+
+	this->m_c_value = result;
+
+	return *this;
 }
 
-[[nodiscard]] BigInt& BigInt::operator%=(const BigInt& value2) const {
-	// TODO
-	UNUSED(value2);
-	throw std::runtime_error("TODO");
+[[nodiscard]] BigInt& BigInt::operator%=(const BigInt& value2) {
+	bigint_check_divisor(value2.m_c_value);
+
+	BigIntC result = bigint_mod(this->m_c_value, value2.m_c_value);
+
+	free_bigint(&(this->m_c_value));
+
+	this->m_c_value = result;
+
+	return *this;
 }
 
-[[nodiscard]] BigInt& BigInt::operator^=(const BigInt& value2) const {
-	// TODO
-	UNUSED(value2);
-	throw std::runtime_error("TODO");
+[[nodiscard]] BigInt& BigInt::operator&=(const BigInt& value2) {
+	BigIntC result = bigint_and(this->m_c_value, value2.m_c_value);
+
+	free_bigint(&(this->m_c_value));
+
+	this->m_c_value = result;
+
+	return *this;
+}
+
+[[nodiscard]] BigInt& BigInt::operator|=(const BigInt& value2) {
+	BigIntC result = bigint_or(this->m_c_value, value2.m_c_value);
+
+	free_bigint(&(this->m_c_value));
+
+	this->m_c_value = result;
+
+	return *this;
+}
+
+[[nodiscard]] BigInt& BigInt::operator^=(const BigInt& value2) {
+	BigIntC result = bigint_xor(this->m_c_value, value2.m_c_value);
+
+	free_bigint(&(this->m_c_value));
+
+	this->m_c_value = result;
+
+	return *this;
 }
 
 std::ostream& operator<<(std::ostream& out_stream, const BigInt& value) {
@@ -538,48 +1100,84 @@ std::istream& operator>>(std::istream& in_stream, const BigInt& value) {
 	throw std::runtime_error("TODO");
 }
 
-[[nodiscard]] BigInt BigInt::operator<<(const BigInt& value2) const {
-	// TODO
-	UNUSED(value2);
-	throw std::runtime_error("TODO");
+[[nodiscard]] BigInt BigInt::operator<<(std::size_t amount) const {
+	BigIntC result = bigint_shl(this->m_c_value, amount);
+
+	return BigInt{ std::move(result) };
 }
 
-[[nodiscard]] BigInt BigInt::operator>>(const BigInt& value2) const {
-	// TODO
-	UNUSED(value2);
-	throw std::runtime_error("TODO");
+[[nodiscard]] BigInt BigInt::operator>>(std::size_t amount) const {
+	BigIntC result = bigint_shr(this->m_c_value, amount);
+
+	return BigInt{ std::move(result) };
 }
 
-[[nodiscard]] BigInt& BigInt::operator>>=(const BigInt& value2) {
-	// TODO
-	UNUSED(value2);
-	throw std::runtime_error("TODO");
+[[nodiscard]] BigInt& BigInt::operator>>=(std::size_t amount) {
+	bigint_shr_in_place(&(this->m_c_value), amount);
+
+	return *this;
 }
 
-[[nodiscard]] BigInt& BigInt::operator<<=(const BigInt& value2) {
-	// TODO
-	UNUSED(value2);
-	throw std::runtime_error("TODO");
+[[nodiscard]] BigInt& BigInt::operator<<=(std::size_t amount) {
+	bigint_shl_in_place(&(this->m_c_value), amount);
+
+	return *this;
+}
+
+[[nodiscard]] std::size_t BigInt::bit_length() const {
+	return bigint_bit_length(this->m_c_value);
+}
+
+[[nodiscard]] std::size_t BigInt::popcount() const {
+	return bigint_popcount(this->m_c_value);
+}
+
+[[nodiscard]] std::size_t BigInt::ctz() const {
+	return bigint_ctz(this->m_c_value);
+}
+
+[[nodiscard]] bool BigInt::test_bit(std::size_t index) const {
+	return bigint_test_bit(this->m_c_value, index);
+}
+
+void BigInt::set_bit(std::size_t index) {
+	bigint_set_bit(&(this->m_c_value), index);
+}
+
+void BigInt::clear_bit(std::size_t index) {
+	bigint_clear_bit(&(this->m_c_value), index);
 }
 
 [[nodiscard]] BigInt& BigInt::operator++() {
-	// TODO
-	throw std::runtime_error("TODO");
+	return *this += static_cast<uint64_t>(1ULL);
 }
 
 [[nodiscard]] BigInt& BigInt::operator--() {
-	// TODO
-	throw std::runtime_error("TODO");
+	return *this -= static_cast<uint64_t>(1ULL);
 }
 
 [[nodiscard]] BigInt BigInt::operator++(int) {
-	// TODO
-	throw std::runtime_error("TODO");
+	BigInt old_value{ bigint_copy(this->m_c_value) };
+
+	BigIntC result = bigint_add_u64(this->m_c_value, 1ULL);
+
+	free_bigint(&(this->m_c_value));
+
+	this->m_c_value = result;
+
+	return old_value;
 }
 
 [[nodiscard]] BigInt BigInt::operator--(int) {
-	// TODO
-	throw std::runtime_error("TODO");
+	BigInt old_value{ bigint_copy(this->m_c_value) };
+
+	BigIntC result = bigint_sub_u64(this->m_c_value, 1ULL);
+
+	free_bigint(&(this->m_c_value));
+
+	this->m_c_value = result;
+
+	return old_value;
 }
 
 [[nodiscard]] std::string BigInt::to_string() const {
@@ -651,5 +1249,87 @@ std::string std::to_string(const BigInt& value) {
 #define bigint_from_list_of_numbers UNDEF
 #define bigint_to_string_hex UNDEF
 #define bigint_to_string_bin UNDEF
+#define bigint_sqr UNDEF
+#define bigint_limbs_add_n UNDEF
+#define bigint_limbs_sub_n UNDEF
+#define bigint_limbs_add_1 UNDEF
+#define bigint_limbs_sub_1 UNDEF
+#define bigint_limbs_mul_1 UNDEF
+#define bigint_limbs_addmul_1 UNDEF
+#define bigint_limbs_submul_1 UNDEF
+#define bigint_limbs_lshift UNDEF
+#define bigint_limbs_rshift UNDEF
+#define bigint_limbs_cmp UNDEF
+#define bigint_limbs_copy UNDEF
+#define bigint_add_u64 UNDEF
+#define bigint_add_i64 UNDEF
+#define bigint_sub_u64 UNDEF
+#define bigint_sub_i64 UNDEF
+#define bigint_mul_u64 UNDEF
+#define bigint_mul_i64 UNDEF
+#define bigint_eq_u64 UNDEF
+#define bigint_eq_i64 UNDEF
+#define bigint_cmp_u64 UNDEF
+#define bigint_cmp_i64 UNDEF
+#define BigIntDivModC UNDEF
+#define bigint_divmod UNDEF
+#define bigint_divmod_floor UNDEF
+#define bigint_div UNDEF
+#define bigint_mod UNDEF
+#define bigint_div_floor UNDEF
+#define bigint_mod_floor UNDEF
+#define bigint_reciprocal UNDEF
+#define BigIntDivisorU64 UNDEF
+#define BigIntDivModU64C UNDEF
+#define bigint_limbs_divrem_1_pre UNDEF
+#define bigint_divisor_u64_from_number UNDEF
+#define bigint_divmod_u64_pre UNDEF
+#define bigint_mod_u64_pre UNDEF
+#define bigint_divexact UNDEF
+#define bigint_divexact_u64 UNDEF
+#define bigint_shl UNDEF
+#define bigint_shr UNDEF
+#define bigint_shl_in_place UNDEF
+#define bigint_shr_in_place UNDEF
+#define bigint_and UNDEF
+#define bigint_or UNDEF
+#define bigint_xor UNDEF
+#define bigint_not UNDEF
+#define bigint_bit_length UNDEF
+#define bigint_popcount UNDEF
+#define bigint_ctz UNDEF
+#define bigint_test_bit UNDEF
+#define bigint_set_bit UNDEF
+#define bigint_clear_bit UNDEF
+#define bigint_pow_u64 UNDEF
+#define bigint_mont_ctx_from_modulus UNDEF
+#define free_bigint_mont_ctx UNDEF
+#define bigint_powm_mont UNDEF
+#define bigint_powm UNDEF
+#define bigint_fixed_base_ctx_from UNDEF
+#define free_bigint_fixed_base_ctx UNDEF
+#define bigint_powm_fixed_base UNDEF
+#define bigint_multi_powm UNDEF
+#define bigint_barrett_ctx_from_modulus UNDEF
+#define free_bigint_barrett_ctx UNDEF
+#define bigint_mod_barrett UNDEF
+#define bigint_mulmod_barrett UNDEF
+#define bigint_is_special_modulus UNDEF
+#define bigint_special_ctx_from_form UNDEF
+#define bigint_special_ctx_from_modulus UNDEF
+#define free_bigint_special_ctx UNDEF
+#define bigint_mod_special UNDEF
+#define bigint_mulmod_special UNDEF
+#define bigint_powm_special UNDEF
+#define bigint_gcd UNDEF
+#define bigint_gcdext UNDEF
+#define bigint_invert UNDEF
+#define bigint_sqrtrem UNDEF
+#define bigint_rootrem UNDEF
+#define bigint_is_probable_prime UNDEF
+#define bigint_next_prime UNDEF
+#define bigint_factorial UNDEF
+#define bigint_binomial UNDEF
+#define bigint_primorial UNDEF
 
 #endif
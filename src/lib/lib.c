@@ -11,6 +11,10 @@
 
 // NOLINTEND(modernize-deprecated-headers)
 
+#if defined(BIGINT_C_USE_THREADS) && BIGINT_C_USE_THREADS == 1
+#include <threads.h>
+#endif
+
 // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic,misc-use-anonymous-namespace,modernize-use-auto,modernize-use-using,cppcoreguidelines-no-malloc)
 
 // functions on maybe bigint
@@ -36,6 +40,9 @@ maybe_bigint_get_error(MaybeBigIntC maybe_big_int) {
 
 #define U64(n) (uint64_t)(n##ULL)
 
+// the amount of bits in one of the stored numbers
+#define NUMBER_BIT_COUNT 64
+
 static void bigint_helper_realloc_to_new_size(BigIntC* big_int) {
 
 	uint64_t* new_numbers =
@@ -452,21 +459,26 @@ NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_from_unsigned_number(uint64_t num
 	return result;
 }
 
+// returns |number|, that always fits into an uint64_t
+NODISCARD static uint64_t helper_unsigned_abs(int64_t number) {
+
+	if(number >= 0LL) {
+		return (uint64_t)number;
+	}
+
+	// overflow, when using - on int64_t
+	if(number < -LLONG_MAX) {
+		return (uint64_t)(-(number + 1LL)) + 1ULL;
+	}
+
+	return (uint64_t)(-number);
+}
+
 NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_from_signed_number(int64_t number) {
 	BigIntC result = bigint_helper_zero();
 
-	if(number < 0LL) {
-		result.positive = false;
-		// overflow, when using - on int64_t
-		if(number < -LLONG_MAX) {
-			result.numbers[0] = (uint64_t)(-(number + 1LL)) + 1ULL;
-		} else {
-			result.numbers[0] = (uint64_t)(-number);
-		}
-	} else {
-		result.positive = true;
-		result.numbers[0] = number;
-	}
+	result.positive = number >= 0LL;
+	result.numbers[0] = helper_unsigned_abs(number);
 
 	return result;
 }
@@ -524,6 +536,10 @@ NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_copy(BigIntC big_int) {
 
 NODISCARD static size_t bigint_helper_bits_of_number_used(uint64_t number) {
 
+#if defined(__GNUC__)
+	// this compiles to a single lzcnt / clz instruction, where available
+	return number == 0 ? 0 : NUMBER_BIT_COUNT - (size_t)__builtin_clzll(number);
+#else
 	uint64_t temp = number;
 	size_t result = 0;
 
@@ -533,163 +549,111 @@ NODISCARD static size_t bigint_helper_bits_of_number_used(uint64_t number) {
 	}
 
 	return result;
+#endif
 }
 
-NODISCARD static BCDDigits bigint_helper_get_bcd_digits_from_bigint(BigIntC source) {
+// returns the amount of leading zero bits of number, number can't be 0
+NODISCARD static size_t helper_count_leading_zeros(uint64_t number) {
 
-	// using double dabble, see
-	// https://en.wikipedia.org/wiki/Double_dabble
+	ASSERT(number != 0, "the leading zeroes of 0 are not defined");
 
-	if(source.number_count == 0) { // GCOVR_EXCL_BR_LINE (every caller assures that)
-		UNREACHABLE_WITH_MSG("not initialized BigIntC correctly"); // GCOVR_EXCL_LINE (see above)
-	} // GCOVR_EXCL_LINE (see above)
+#if defined(__GNUC__)
+	return (size_t)__builtin_clzll(number);
+#else
+	return NUMBER_BIT_COUNT - bigint_helper_bits_of_number_used(number);
+#endif
+}
 
-	// reverse the source so that the bits are aligned
-	{
-		for(size_t i = 0; i < source.number_count / 2; ++i) {
-			const uint64_t temp = source.numbers[i];
-			source.numbers[i] = source.numbers[source.number_count - 1 - i];
+// returns the amount of trailing zero bits of number, number can't be 0
+NODISCARD static size_t helper_count_trailing_zeros(uint64_t number) {
 
-			source.numbers[source.number_count - 1 - i] = temp;
-		}
-	}
+	ASSERT(number != 0, "the trailing zeroes of 0 are not defined");
 
-	size_t last_number_bit_amount = bigint_helper_bits_of_number_used(
-	    source.numbers[0]); // range 0 -64 0 should never be here, as then i should have remove
-	                        // it earlier (remove leading zeroes!)
+#if defined(__GNUC__)
+	return (size_t)__builtin_ctzll(number);
+#else
+	size_t result = 0;
 
-	// but it is here when the value is just 0 ("0")
-	if(last_number_bit_amount == 0) {
-		last_number_bit_amount = 1; // print one 0, even if it's a not a 1
+	while((number & 0x01) == 0) {
+		number = number >> 1;
+		++result;
 	}
 
-	// calculate the amount of input bits
-	const size_t total_input_bits = source.number_count * BIGINT_BIT_COUNT_FOR_BCD_ALG;
-
-	// setup working variables
-	BCDDigits bcd_digits = { .bcd_digits = NULL, .count = 0, .capacity = 0 };
-
-	size_t current_bit =
-	    BIGINT_BIT_COUNT_FOR_BCD_ALG -
-	    last_number_bit_amount; // range 0 - 63 at start, later 0 -> total_input_bits -1
-
-	while(current_bit < total_input_bits) {
-
-		{ // 1. For each bcd_digit
-
-			for(size_t i = 0; i < bcd_digits.count; ++i) {
-
-				// 2.1. If value >= 5 then add 3 to value
-
-				const BCDDigit value = bcd_digits.bcd_digits[i];
-
-				if(value >=
-				   5) { // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-					bcd_digits.bcd_digits[i] = bcd_digits.bcd_digits[i] + 3;
-				}
-			}
-		}
-
-		{ // 2. shift left by one
-
-			{ // 2.1. shift every bcd_output to the left
-				// ( not in 8 but in 4 bit shifts), for
-				// convience we shift to the right in the array elements as the order is [0., 1.
-				// ] and we need to shift from the 0. left to the 1.
+	return result;
+#endif
+}
 
-				{ // 2.1.1. if we need a new bcd_digit, allocate it and set it to 0
+// returns the amount of set bits of number
+NODISCARD static size_t helper_popcount(uint64_t number) {
 
-					bool needs_new_digit = false;
+#if defined(__GNUC__)
+	return (size_t)__builtin_popcountll(number);
+#else
+	// see: https://en.wikipedia.org/wiki/Hamming_weight
+	number = number - ((number >> 1) & U64(0x5555555555555555));
+	number = (number & U64(0x3333333333333333)) + ((number >> 2) & U64(0x3333333333333333));
+	number = (number + (number >> 4)) & U64(0x0F0F0F0F0F0F0F0F);
 
-					{ // 2.1.1.1. determine if we need a new bcd_digit
+	return (size_t)((number * U64(0x0101010101010101)) >> 56);
+#endif
+}
 
-						// 2.1.1.2. if no digits i present, we need a new one
-						if(bcd_digits.count == 0) {
-							needs_new_digit = true;
-						} else {
-							// 2.1.1.3. we need a new one, if the next shift would overflow!
-							const BCDDigit value = bcd_digits.bcd_digits[bcd_digits.count - 1];
-							const uint8_t first_bit =
-							    (value >> (BCD_DIGIT_BIT_COUNT_FOR_BCD_ALG - 1)) & 0x01;
-							if(first_bit != 0) {
-								needs_new_digit = true;
-							}
-						}
-					}
+// 10^19 is the biggest power of 10, that fits into one number
+#define DECIMAL_CHUNK_DIVISOR U64(10000000000000000000)
+#define DECIMAL_CHUNK_DIGITS 19
+#define DECIMAL_BASE 10
 
-					if(needs_new_digit) {
-						helper_add_value_to_bcd_digits(&bcd_digits, 0);
-					}
-				}
+// TODO: support also some options, as for to_string_hex and to_string_bin
+NODISCARD BIGINT_C_LIB_EXPORTED Str bigint_to_string(BigIntC big_int) {
 
-				{ // 2.1.2 shift the first bit (4. bit) of every number into the next one
+	if(big_int.number_count == 0) {
+		return NULL;
+	}
 
-					for(size_t i = bcd_digits.count; i != 0; --i) {
+	// one number has at most 19.27 decimal digits, so this is enough for all chunks
+	const size_t chunk_capacity = big_int.number_count + (big_int.number_count / 64) + 2;
 
-						const BCDDigit value = bcd_digits.bcd_digits[i - 1];
+	uint64_t* chunks = (uint64_t*)malloc(sizeof(uint64_t) * chunk_capacity);
 
-						const uint8_t first_bit =
-						    (value >> (BCD_DIGIT_BIT_COUNT_FOR_BCD_ALG - 1)) & 0x01;
+	if(chunks == NULL) { // GCOVR_EXCL_BR_LINE (OOM)
+		return NULL;     // GCOVR_EXCL_LINE (OOM content)
+	}
 
-						if(i == bcd_digits.count) {
-							ASSERT((first_bit == 0), "the first bit of the first bcd_digit has to "
-							                         "be 0, as this was just created empty or "
-							                         "should only get the value after this shift");
-						} else {
-							if(first_bit != 0) {
-								bcd_digits.bcd_digits[i] = bcd_digits.bcd_digits[i] | first_bit;
-							}
-						}
+	size_t chunk_count = 0;
 
-						// shift to the left, but only keep 4 bits
-						bcd_digits.bcd_digits[i - 1] =
-						    (bcd_digits.bcd_digits[i - 1] << 1) &
-						    (((BCDDigit)1 << BCD_DIGIT_BIT_COUNT_FOR_BCD_ALG) - (BCDDigit)1);
-					}
-				}
-			}
+	{ // 1. split the number into chunks of 19 decimal digits, by dividing it by 10^19 until it is
+	  // 0, the least significant chunk comes first, the reciprocal of 10^19 is computed only once,
+	  // so every step only needs multiplications
 
-			{ // 2.2 shift first input bit into the bcd_result
+		const BigIntDivisorU64 divisor = bigint_divisor_u64_from_number(DECIMAL_CHUNK_DIVISOR);
 
-				const size_t input_index = current_bit / BIGINT_BIT_COUNT_FOR_BCD_ALG;
+		BigIntC copy = bigint_helper_get_full_copy(big_int);
 
-				const size_t input_u64_index =
-				    BIGINT_BIT_COUNT_FOR_BCD_ALG - (current_bit % BIGINT_BIT_COUNT_FOR_BCD_ALG) - 1;
+		size_t count = copy.number_count;
 
-				ASSERT(input_index < source.number_count, "input index would index out of bounds");
+		do {
+			ASSERT(chunk_count < chunk_capacity, "string conversion overflowed the chunks");
 
-				const uint8_t first_bit = (source.numbers[input_index] >> input_u64_index) & 0x01;
+			chunks[chunk_count] =
+			    bigint_limbs_divrem_1_pre(copy.numbers, copy.numbers, count, divisor);
+			++chunk_count;
 
-				ASSERT(bcd_digits.count > 0, "bcd_digits has to be initialized");
-				if(first_bit != 0) {
-					bcd_digits.bcd_digits[0] = bcd_digits.bcd_digits[0] | first_bit;
-				}
+			while(count != 0 && copy.numbers[count - 1] == 0) {
+				--count;
 			}
-		}
+		} while(count != 0);
 
-		// increment current_bit
-		++current_bit;
+		free_bigint(&copy);
 	}
 
-	return bcd_digits;
-}
-
-// TODO: support also some options, as for to_string_hex and to_string_bin
-NODISCARD BIGINT_C_LIB_EXPORTED Str bigint_to_string(BigIntC big_int) {
+	// the most significant chunk has no leading zeroes, all others are padded to 19 digits
+	size_t top_digit_count = 1;
 
-	if(big_int.number_count == 0) {
-		return NULL;
+	for(uint64_t top = chunks[chunk_count - 1] / DECIMAL_BASE; top != 0; top = top / DECIMAL_BASE) {
+		++top_digit_count;
 	}
 
-	BigIntC copy = bigint_helper_get_full_copy(big_int);
-
-	const BCDDigits bcd_digits = bigint_helper_get_bcd_digits_from_bigint(copy);
-
-	free_bigint(&copy);
-
-	// format bcd_digits into a string, note that the bcd_digits are stored reversed
-
-	size_t string_size = bcd_digits.count;
+	size_t string_size = top_digit_count + ((chunk_count - 1) * DECIMAL_CHUNK_DIGITS);
 
 	if(!big_int.positive) {
 		string_size = string_size + 1;
@@ -697,31 +661,39 @@ NODISCARD BIGINT_C_LIB_EXPORTED Str bigint_to_string(BigIntC big_int) {
 
 	Str str = (Str)malloc(sizeof(StrType) * (string_size + 1));
 
-	if(str == NULL) {                // GCOVR_EXCL_BR_LINE (OOM)
-		free_bcd_digits(bcd_digits); // GCOVR_EXCL_LINE (OOM content)
-		return NULL;                 // GCOVR_EXCL_LINE (OOM content)
+	if(str == NULL) { // GCOVR_EXCL_BR_LINE (OOM)
+		free(chunks); // GCOVR_EXCL_LINE (OOM content)
+		return NULL;  // GCOVR_EXCL_LINE (OOM content)
 	}
 
 	str[string_size] = '\0';
 
-	size_t index = 0;
-
 	if(!big_int.positive) {
-		str[index] = '-';
-		++index;
+		str[0] = '-';
 	}
 
-	const size_t offset = string_size - bcd_digits.count;
+	{ // 2. write the digits of every chunk, starting at the end of the string
+
+		size_t index = string_size;
+
+		for(size_t i = 0; i < chunk_count; ++i) {
+
+			const size_t digit_count =
+			    i == chunk_count - 1 ? top_digit_count : DECIMAL_CHUNK_DIGITS;
 
-	for(; index < string_size; ++index) {
+			uint64_t chunk = chunks[i];
 
-		const size_t digits_index = offset + bcd_digits.count - index - 1;
-		ASSERT(digits_index < bcd_digits.count, "string conversion overflowed bcd_digits");
+			for(size_t j = 0; j < digit_count; ++j) {
+				--index;
+				str[index] = helper_digit_to_char_checked((uint8_t)(chunk % DECIMAL_BASE));
+				chunk = chunk / DECIMAL_BASE;
+			}
+		}
 
-		str[index] = helper_digit_to_char_checked(bcd_digits.bcd_digits[digits_index]);
+		ASSERT(index == (big_int.positive ? 0 : 1), "string conversion didn't fill the string");
 	}
 
-	free_bcd_digits(bcd_digits);
+	free(chunks);
 
 	return str;
 }
@@ -909,8 +881,8 @@ NODISCARD BIGINT_C_LIB_EXPORTED Str bigint_to_string_bin(BigIntC big_int, bool p
 	return str;
 }
 
-NODISCARD static size_t helper_max(size_t num1, size_t num2) {
-	if(num1 > num2) {
+NODISCARD static size_t helper_min(size_t num1, size_t num2) {
+	if(num1 < num2) {
 		return num1;
 	}
 	return num2;
@@ -927,103 +899,8 @@ typedef __int128_t int128_t;   // NOLINT(readability-identifier-naming)
 #error "unknown BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION"
 #endif
 
-#if BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION == 0
-
-NODISCARD static BigIntC bigint_add_bigint_both_positive_using_128_bit_numbers(BigIntC big_int1,
-                                                                               BigIntC big_int2) {
-
-	const size_t max_count = helper_max(big_int1.number_count, big_int2.number_count) + 1;
-
-	BigIntC result = { .positive = true, .numbers = NULL, .number_count = max_count };
-
-	bigint_helper_realloc_to_new_size(&result);
-
-	{ // 1. perform the actual addition
-
-		uint64_t carry = U64(0);
-
-		for(size_t i = 0; i < result.number_count; ++i) {
-
-			uint128_t sum = (uint128_t)carry;
-
-			if(i < big_int1.number_count) {
-				sum = sum + (uint128_t)big_int1.numbers[i];
-			}
-
-			if(i < big_int2.number_count) {
-				sum = sum + (uint128_t)big_int2.numbers[i];
-			}
-
-			result.numbers[i] = (uint64_t)sum;
-
-			carry =
-			    (uint64_t)(sum >>
-			               64); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-		}
-
-		ASSERT(carry == 0,
-		       "The carry at the end has to be zero, otherwise we would have an overflow");
-	}
-
-	bigint_helper_remove_leading_zeroes(&result);
-
-	return result;
-}
-
-NODISCARD static BigIntC bigint_sub_bigint_both_positive_using_128_bit_numbers(BigIntC big_int1,
-                                                                               BigIntC big_int2) {
-
-	// NOTE: here it is assumed, that  a > b
-
-	const size_t max_count = helper_max(big_int1.number_count, big_int2.number_count) + 1;
-
-	BigIntC result = { .positive = true, .numbers = NULL, .number_count = max_count };
-
-	bigint_helper_realloc_to_new_size(&result);
-
-	{ // 1. perform the actual subtraction
-
-		int64_t borrow = (int64_t)0LL;
-
-		for(size_t i = 0; i < result.number_count; ++i) {
-
-			int128_t temp = (int128_t)0LL;
-
-			if(i < big_int1.number_count) {
-				temp = (int128_t)big_int1.numbers[i];
-			}
-
-			if(i < big_int2.number_count) {
-				temp = temp - (int128_t)big_int2.numbers[i];
-			}
-
-			if(borrow != 0) {
-				temp = temp - borrow;
-			}
-
-			// check if we need to adjust temp and set the borrow
-			if(temp >= 0) {
-				borrow = (int64_t)0LL;
-			} else {
-				temp =
-				    ((int128_t)1
-				     << 64) + // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
-				    temp;
-				borrow = (int64_t)1LL;
-			}
-
-			result.numbers[i] = (uint64_t)temp;
-		}
-
-		ASSERT(borrow == 0,
-		       "The borrow at the end has to be zero, otherwise we would have an overflow");
-	}
-
-	bigint_helper_remove_leading_zeroes(&result);
-
-	return result;
-}
-#elif BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION == 1
+// the carry and borrow helpers are used by both underlying computation implementations, as the
+// limb kernels (e.g. for squaring) are written on top of them
 
 NODISCARD static uint8_t bigint_helper_add_uint64_with_carry(uint8_t carry_in, uint64_t value1,
                                                              uint64_t value2, uint64_t* result_out);
@@ -1151,200 +1028,456 @@ NODISCARD static inline uint8_t bigint_helper_sub_uint64_with_borrow(uint8_t bor
 
 #endif
 
-NODISCARD static BigIntC bigint_add_bigint_both_positive_normal(BigIntC big_int1,
-                                                                BigIntC big_int2) {
+static void bigint_mul_two_numbers_impl(uint64_t big_int1, uint64_t big_int2, uint64_t* low,
+                                        uint64_t* high);
 
-	size_t max_count = helper_max(big_int1.number_count, big_int2.number_count) + 1;
+#if BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION == 0
 
-	BigIntC result = { .positive = true, .number_count = max_count, .numbers = NULL };
+static void
+bigint_mul_two_numbers_impl(uint64_t big_int1, uint64_t big_int2,
+                            uint64_t* low, // NOLINT(bugprone-easily-swappable-parameters)
+                            uint64_t* high) {
 
-	bigint_helper_realloc_to_new_size(&result);
+	uint128_t result = (uint128_t)big_int1 * (uint128_t)big_int2;
+
+	*low = (uint64_t)result;
+	*high =
+	    (uint64_t)(result >>
+	               64); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+}
+
+#else
 
-	{ // 1. perform the actual addition
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(__x86_64__) || defined(__amd64__))
 
-		uint8_t carry = U64(0);
+// use fast intrinsic on x86_64 (_umul128 is only supported in msvc, as gcc / clang and linux
+// support all operations on 128 bits numbers, but that is not enabled with
+// BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION == 1)
 
-		for(size_t i = 0; i < result.number_count; ++i) {
+#include <intrin.h>
 
-			uint64_t value1 = U64(0);
-			uint64_t value2 = U64(0);
+static void bigint_mul_two_numbers_impl(uint64_t big_int1, uint64_t big_int2, uint64_t* low,
+                                        uint64_t* high) {
 
-			if(i < big_int1.number_count) {
-				value1 = big_int1.numbers[i];
-			}
+	// see https://learn.microsoft.com/en-us/cpp/intrinsics/umul128?view=msvc-170
+	*low = _umul128(big_int1, big_int2, high);
+}
 
-			if(i < big_int2.number_count) {
-				value2 = big_int2.numbers[i];
-			}
+#elif defined(_MSC_VER) && (defined(__aarch64__))
 
-			carry =
-			    bigint_helper_add_uint64_with_carry(carry, value1, value2, &(result.numbers[i]));
-		}
+// use fast intrinsic on aarch64 (__umulh is only supported in msvc, as gcc / clang and linux
+// support all operations on 128 bits numbers, but that is not enabled with
+// BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION == 1)
 
-		ASSERT(carry == 0,
-		       "The carry at the end has to be zero, otherwise we would have an overflow");
-	}
+#include <intrin.h>
 
-	bigint_helper_remove_leading_zeroes(&result);
+static void bigint_mul_two_numbers_impl(uint64_t big_int1, uint64_t big_int2, uint64_t* low,
+                                        uint64_t* high) {
 
-	return result;
+	*low = (uint64_t)(big_int1 * big_int2);
+
+	*high = __umulh(big_int1, big_int2);
 }
 
-NODISCARD static BigIntC bigint_sub_bigint_both_positive_normal(BigIntC big_int1,
-                                                                BigIntC big_int2) {
+#else
+
+static void bigint_mul_two_numbers_impl(uint64_t big_int1, uint64_t big_int2, uint64_t* low,
+                                        uint64_t* high) {
 
-	// NOTE: here it is assumed, that  a > b
+	uint64_t b1_low = (uint32_t)(big_int1);
+	uint64_t b1_high = big_int1 >> 32;
+	uint64_t b2_low = (uint32_t)(big_int2);
+	uint64_t b2_high = big_int2 >> 32;
 
-	size_t max_count = helper_max(big_int1.number_count, big_int2.number_count) + 1;
+	uint64_t res_ll = b1_low * b2_low;
+	uint64_t res_lh = b1_low * b2_high;
+	uint64_t res_hl = b1_high * b2_low;
+	uint64_t res_hh = b1_high * b2_high;
 
-	BigIntC result = { .positive = true, .number_count = max_count, .numbers = NULL };
+	uint64_t carry = ((res_ll >> 32) + (res_lh & 0xFFFFFFFF) + (res_hl & 0xFFFFFFFF)) >> 32;
 
-	bigint_helper_realloc_to_new_size(&result);
+	*low = res_ll + (res_lh << 32) + (res_hl << 32);
+	*high = res_hh + (res_lh >> 32) + (res_hl >> 32) + carry;
+}
+#endif
+#endif
 
-	{ // 1. perform the actual subtraction
+// low level functions on raw numbers, these operate on raw uint64_t arrays (least significant
+// first) and never allocate, all the higher level functions are built on top of them
 
-		unsigned char borrow = 0;
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_add_n(uint64_t* result,
+                                                            const uint64_t* numbers1,
+                                                            const uint64_t* numbers2,
+                                                            size_t count) {
 
-		for(size_t i = 0; i < result.number_count; ++i) {
+#if BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION == 0
 
-			uint64_t value1 = U64(0);
-			uint64_t value2 = U64(0);
+	uint64_t carry = U64(0);
 
-			if(i < big_int1.number_count) {
-				value1 = big_int1.numbers[i];
-			}
+	for(size_t i = 0; i < count; ++i) {
 
-			if(i < big_int2.number_count) {
-				value2 = big_int2.numbers[i];
-			}
+		const uint128_t sum = (uint128_t)numbers1[i] + (uint128_t)numbers2[i] + (uint128_t)carry;
 
-			borrow =
-			    bigint_helper_sub_uint64_with_borrow(borrow, value1, value2, &(result.numbers[i]));
-		}
+		result[i] = (uint64_t)sum;
 
-		ASSERT(borrow == 0,
-		       "The borrow at the end has to be zero, otherwise we would have an overflow");
+		carry = (uint64_t)(sum >> NUMBER_BIT_COUNT);
 	}
 
-	bigint_helper_remove_leading_zeroes(&result);
-
-	return result;
-}
+	return carry;
 #else
-#error "unknown BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION"
-#endif
 
-NODISCARD static BigIntC bigint_add_bigint_both_positive(BigIntC big_int1, BigIntC big_int2) {
+	uint8_t carry = 0;
 
-#if BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION == 0
-	return bigint_add_bigint_both_positive_using_128_bit_numbers(big_int1, big_int2);
-#else
-	return bigint_add_bigint_both_positive_normal(big_int1, big_int2);
-// TODO: use asm if on x86_64 or arm64 / or standard c way!
+	for(size_t i = 0; i < count; ++i) {
+		carry = bigint_helper_add_uint64_with_carry(carry, numbers1[i], numbers2[i], &(result[i]));
+	}
+
+	return carry;
 #endif
 }
 
-NODISCARD BIGINT_C_LIB_EXPORTED BigIntC
-bigint_add_bigint(BigIntC big_int1, BigIntC big_int2) { // NOLINT(misc-no-recursion)
-
-	if(big_int1.positive) {
-
-		if(big_int2.positive) {
-			// +a + +b
-			return bigint_add_bigint_both_positive(big_int1, big_int2);
-		}
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_sub_n(uint64_t* result,
+                                                            const uint64_t* numbers1,
+                                                            const uint64_t* numbers2,
+                                                            size_t count) {
 
-		// +a + -b = +a - +b
-		big_int2.positive = true;
-		return bigint_sub_bigint(big_int1, big_int2);
-	}
+#if BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION == 0
 
-	if(big_int2.positive) {
-		// -a + +b = +b - +a
-		big_int1.positive = true;
-		return bigint_sub_bigint(big_int2, // NOLINT(readability-suspicious-call-argument)
-		                         big_int1);
-	}
+	uint64_t borrow = U64(0);
 
-	// both are negative
+	for(size_t i = 0; i < count; ++i) {
 
-	// -a + -b = - ( +a + +b )
+		const uint128_t difference =
+		    (uint128_t)numbers1[i] - (uint128_t)numbers2[i] - (uint128_t)borrow;
 
-	big_int1.positive = true;
-	big_int2.positive = true;
+		result[i] = (uint64_t)difference;
 
-	BigIntC result = bigint_add_bigint_both_positive(big_int1, big_int2);
+		// if the subtraction wrapped around, all upper bits are set
+		borrow = (uint64_t)(difference >> NUMBER_BIT_COUNT) & 0x01;
+	}
 
-	result.positive = false;
+	return borrow;
+#else
 
-	return result;
-}
+	uint8_t borrow = 0;
 
-NODISCARD static BigIntC bigint_sub_bigint_both_positive_impl(BigIntC big_int1, BigIntC big_int2) {
+	for(size_t i = 0; i < count; ++i) {
+		borrow =
+		    bigint_helper_sub_uint64_with_borrow(borrow, numbers1[i], numbers2[i], &(result[i]));
+	}
 
-#if BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION == 0
-	return bigint_sub_bigint_both_positive_using_128_bit_numbers(big_int1, big_int2);
-#else
-	return bigint_sub_bigint_both_positive_normal(big_int1, big_int2);
+	return borrow;
 #endif
 }
 
-NODISCARD static BigIntC bigint_sub_bigint_both_positive(BigIntC big_int1, BigIntC big_int2) {
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_add_1(uint64_t* result,
+                                                            const uint64_t* numbers, size_t count,
+                                                            uint64_t value) {
 
-	// check in which direction we need to perform the subtraction
-	const int8_t compared = bigint_compare_bigint(big_int1, big_int2);
+	uint64_t carry = value;
 
-	if(compared == 0) {
-		return bigint_helper_zero();
-	}
+	size_t i = 0;
 
-	if(compared > 0) {
-		return bigint_sub_bigint_both_positive_impl(big_int1, big_int2);
+	for(; carry != 0 && i < count; ++i) {
+		const uint64_t sum = numbers[i] + carry;
+		carry = sum < carry ? 1 : 0;
+		result[i] = sum;
 	}
 
-	// +a - +b where b > a = - ( +b - +a)
-	BigIntC result =
-	    bigint_sub_bigint_both_positive_impl( // NOLINT(readability-suspicious-call-argument)
-	        big_int2, big_int1);
+	// if the carry stopped early, the rest is just copied
+	if(result != numbers) {
+		for(; i < count; ++i) {
+			result[i] = numbers[i];
+		}
+	}
 
-	result.positive = false;
-	return result;
+	return carry;
 }
 
-NODISCARD BIGINT_C_LIB_EXPORTED BigIntC
-bigint_sub_bigint(BigIntC big_int1, BigIntC big_int2) { // NOLINT(misc-no-recursion)
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_sub_1(uint64_t* result,
+                                                            const uint64_t* numbers, size_t count,
+                                                            uint64_t value) {
 
-	if(big_int1.positive) {
-		if(big_int2.positive) {
-			//+a - +b
-			return bigint_sub_bigint_both_positive(big_int1, big_int2);
+	uint64_t borrow = value;
+
+	size_t i = 0;
+
+	for(; borrow != 0 && i < count; ++i) {
+		const uint64_t number = numbers[i];
+		result[i] = number - borrow;
+		borrow = number < borrow ? 1 : 0;
+	}
+
+	// if the borrow stopped early, the rest is just copied
+	if(result != numbers) {
+		for(; i < count; ++i) {
+			result[i] = numbers[i];
 		}
+	}
 
-		// +a - -b = +a + +b
-		big_int2.positive = true;
-		return bigint_add_bigint(big_int1, big_int2);
+	return borrow;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_mul_1(uint64_t* result,
+                                                            const uint64_t* numbers, size_t count,
+                                                            uint64_t factor) {
+
+	uint64_t carry = U64(0);
+
+	for(size_t i = 0; i < count; ++i) {
+		uint64_t low = U64(0);
+		uint64_t high = U64(0);
+
+		bigint_mul_two_numbers_impl(numbers[i], factor, &low, &high);
+
+		const uint8_t carry1 = bigint_helper_add_uint64_with_carry(0, low, carry, &(result[i]));
+
+		// numbers[i] * factor + carry <= 2^128 - 1, so this can't overflow
+		carry = high + carry1;
 	}
 
-	if(big_int2.positive) {
-		// -a - +b = -a + -b
-		big_int2.positive = false;
-		return bigint_add_bigint(big_int1, big_int2);
+	return carry;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_addmul_1(uint64_t* result,
+                                                               const uint64_t* numbers,
+                                                               size_t count, uint64_t factor) {
+
+	uint64_t carry = U64(0);
+
+	for(size_t i = 0; i < count; ++i) {
+		uint64_t low = U64(0);
+		uint64_t high = U64(0);
+
+		bigint_mul_two_numbers_impl(numbers[i], factor, &low, &high);
+
+		const uint8_t carry1 = bigint_helper_add_uint64_with_carry(0, low, carry, &low);
+		const uint8_t carry2 = bigint_helper_add_uint64_with_carry(0, result[i], low, &(result[i]));
+
+		// numbers[i] * factor + carry + result[i] <= 2^128 - 1, so this can't overflow
+		carry = high + carry1 + carry2;
 	}
 
-	// both are negative
+	return carry;
+}
 
-	// -a - -b = -a + +b = +b - +a
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_submul_1(uint64_t* result,
+                                                               const uint64_t* numbers,
+                                                               size_t count, uint64_t factor) {
 
-	big_int1.positive = true;
-	big_int2.positive = true;
+	uint64_t borrow = U64(0);
 
-	BigIntC result =
-	    bigint_sub_bigint_both_positive( // NOLINT(readability-suspicious-call-argument)
-	        big_int2, big_int1);
+	for(size_t i = 0; i < count; ++i) {
+		uint64_t low = U64(0);
+		uint64_t high = U64(0);
+
+		bigint_mul_two_numbers_impl(numbers[i], factor, &low, &high);
+
+		const uint8_t borrow1 = bigint_helper_add_uint64_with_carry(0, low, borrow, &low);
+		const uint8_t borrow2 =
+		    bigint_helper_sub_uint64_with_borrow(0, result[i], low, &(result[i]));
+
+		// numbers[i] * factor + borrow <= 2^128 - 1, so this can't overflow
+		borrow = high + borrow1 + borrow2;
+	}
+
+	return borrow;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_lshift(uint64_t* result,
+                                                             const uint64_t* numbers, size_t count,
+                                                             unsigned int shift) {
+
+	ASSERT(shift < NUMBER_BIT_COUNT, "shift has to be less than the bits of one number");
+
+	if(count == 0) {
+		return U64(0);
+	}
+
+	if(shift == 0) {
+		bigint_limbs_copy(result, numbers, count);
+		return U64(0);
+	}
+
+	// this goes from the top to the bottom, so that result can be the same as numbers
+	const uint64_t shifted_out = numbers[count - 1] >> (NUMBER_BIT_COUNT - shift);
+
+	for(size_t i = count - 1; i != 0; --i) {
+		result[i] = (numbers[i] << shift) | (numbers[i - 1] >> (NUMBER_BIT_COUNT - shift));
+	}
+
+	result[0] = numbers[0] << shift;
+
+	return shifted_out;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_rshift(uint64_t* result,
+                                                             const uint64_t* numbers, size_t count,
+                                                             unsigned int shift) {
+
+	ASSERT(shift < NUMBER_BIT_COUNT, "shift has to be less than the bits of one number");
+
+	if(count == 0) {
+		return U64(0);
+	}
+
+	if(shift == 0) {
+		bigint_limbs_copy(result, numbers, count);
+		return U64(0);
+	}
+
+	// this goes from the bottom to the top, so that result can be the same as numbers
+	const uint64_t shifted_out = numbers[0] << (NUMBER_BIT_COUNT - shift);
+
+	for(size_t i = 0; i + 1 < count; ++i) {
+		result[i] = (numbers[i] >> shift) | (numbers[i + 1] << (NUMBER_BIT_COUNT - shift));
+	}
+
+	result[count - 1] = numbers[count - 1] >> shift;
+
+	return shifted_out;
+}
+
+#define CMP_FIRST_ONE_IS_LESS ((int8_t)-1)
+#define CMP_FIRST_ONE_IS_GREATER ((int8_t)1)
+#define CMP_ARE_EQUAL ((int8_t)0)
+
+NODISCARD BIGINT_C_LIB_EXPORTED int8_t bigint_limbs_cmp(const uint64_t* numbers1,
+                                                        const uint64_t* numbers2, size_t count) {
+
+	for(size_t i = count; i != 0; --i) {
+		const uint64_t num1 = numbers1[i - 1];
+		const uint64_t num2 = numbers2[i - 1];
+
+		if(num1 < num2) {
+			return CMP_FIRST_ONE_IS_LESS;
+		}
+
+		if(num1 > num2) {
+			return CMP_FIRST_ONE_IS_GREATER;
+		}
+	}
+
+	return CMP_ARE_EQUAL;
+}
+
+BIGINT_C_LIB_EXPORTED void bigint_limbs_copy(uint64_t* result, const uint64_t* numbers,
+                                             size_t count) {
+
+	if(count == 0 || result == numbers) {
+		return;
+	}
+
+	memmove(result, numbers, sizeof(uint64_t) * count);
+}
+
+// returns sign1 * |big_int1| + sign2 * |big_int2|, the signs of the arguments themselves are
+// ignored, this handles all sign combinations of addition and subtraction in one pass over the
+// numbers, the result is allocated with the exact size, that it needs
+NODISCARD static BigIntC bigint_helper_add_signed(BigIntC big_int1, bool positive1,
+                                                  BigIntC big_int2, bool positive2) {
+
+	// the first number has the greater (or equal) magnitude afterwards, so that the rest of it only
+	// has to absorb the carry / borrow
+	size_t count = big_int1.number_count;
+
+	const bool subtract = positive1 != positive2;
+
+	if(!subtract) {
+		// +a + +b = + (|a| + |b|) and -a + -b = - (|a| + |b|)
+
+		if(big_int1.number_count < big_int2.number_count) {
+			const BigIntC temp = big_int1;
+			big_int1 = big_int2;
+			big_int2 = temp;
+			count = big_int1.number_count;
+		}
+	} else {
+		// +a + -b = + (|a| - |b|) and -a + +b = - (|a| - |b|), the direction is determined by the
+		// highest number, in which they differ, the numbers above it are the same and cancel each
+		// other out, so they don't need to be touched at all
+
+		bool swap = big_int1.number_count < big_int2.number_count;
+
+		if(big_int1.number_count == big_int2.number_count) {
+
+			while(count != 0 && big_int1.numbers[count - 1] == big_int2.numbers[count - 1]) {
+				--count;
+			}
+
+			if(count == 0) {
+				// |a| - |a| = 0
+				return bigint_helper_zero();
+			}
+
+			swap = big_int1.numbers[count - 1] < big_int2.numbers[count - 1];
+		}
+
+		if(swap) {
+			const BigIntC temp = big_int1;
+			big_int1 = big_int2;
+			big_int2 = temp;
+			positive1 = positive2;
+
+			if(big_int1.number_count != big_int2.number_count) {
+				count = big_int1.number_count;
+			}
+		}
+	}
+
+	const size_t short_count = helper_min(count, big_int2.number_count);
+
+	BigIntC result = { .positive = true, .numbers = NULL, .number_count = count };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	if(!subtract) {
+
+		uint64_t carry = bigint_limbs_add_n(result.numbers, big_int1.numbers, big_int2.numbers,
+		                                    short_count);
+
+		carry = bigint_limbs_add_1(result.numbers + short_count, big_int1.numbers + short_count,
+		                           count - short_count, carry);
+
+		// only a carry out of the top needs one more number
+		if(carry != 0) {
+			result.number_count = count + 1;
+			bigint_helper_realloc_to_new_size(&result);
+			result.numbers[count] = carry;
+		}
+	} else {
+
+		uint64_t borrow = bigint_limbs_sub_n(result.numbers, big_int1.numbers, big_int2.numbers,
+		                                     short_count);
+
+		borrow = bigint_limbs_sub_1(result.numbers + short_count, big_int1.numbers + short_count,
+		                            count - short_count, borrow);
+
+		ASSERT(borrow == 0,
+		       "The borrow at the end has to be zero, otherwise we would have an overflow");
+		UNUSED(borrow);
+
+		// the subtraction can cancel out some of the top numbers
+		bigint_helper_remove_leading_zeroes(&result);
+	}
+
+	// the result is not 0 here, so it can just be negated
+	if(!positive1) {
+		bigint_negate(&result);
+	}
 
 	return result;
 }
 
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_add_bigint(BigIntC big_int1, BigIntC big_int2) {
+	return bigint_helper_add_signed(big_int1, big_int1.positive, big_int2, big_int2.positive);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_sub_bigint(BigIntC big_int1, BigIntC big_int2) {
+	// a - b = a + (-b)
+	return bigint_helper_add_signed(big_int1, big_int1.positive, big_int2, !big_int2.positive);
+}
+
 NODISCARD BIGINT_C_LIB_EXPORTED bool bigint_eq_bigint(BigIntC big_int1, BigIntC big_int2) {
 	if(big_int1.positive != big_int2.positive) {
 		return false;
@@ -1375,10 +1508,6 @@ NODISCARD static int8_t cmp_reverse(int8_t value) {
 	return 1;
 }
 
-#define CMP_FIRST_ONE_IS_LESS ((int8_t)-1)
-#define CMP_FIRST_ONE_IS_GREATER ((int8_t)1)
-#define CMP_ARE_EQUAL ((int8_t)0)
-
 NODISCARD BIGINT_C_LIB_EXPORTED int8_t
 bigint_compare_bigint(BigIntC big_int1, BigIntC big_int2) { // NOLINT(misc-no-recursion)
 
@@ -1412,20 +1541,7 @@ bigint_compare_bigint(BigIntC big_int1, BigIntC big_int2) { // NOLINT(misc-no-re
 		return CMP_FIRST_ONE_IS_GREATER;
 	}
 
-	for(size_t i = big_int1.number_count; i != 0; --i) {
-		const uint64_t num1 = big_int1.numbers[i - 1];
-		const uint64_t num2 = big_int2.numbers[i - 1];
-
-		if(num1 < num2) {
-			return CMP_FIRST_ONE_IS_LESS;
-		}
-
-		if(num1 > num2) {
-			return CMP_FIRST_ONE_IS_GREATER;
-		}
-	}
-
-	return CMP_ARE_EQUAL;
+	return bigint_limbs_cmp(big_int1.numbers, big_int2.numbers, big_int1.number_count);
 }
 
 BIGINT_C_LIB_EXPORTED void bigint_negate(BigIntC* big_int) {
@@ -1444,361 +1560,628 @@ typedef struct {
 	size_t number_count;
 } BigIntSlice;
 
-typedef struct {
-	const uint64_t* numbers;
-	size_t number_count;
-} BigIntNullableSlice;
+NODISCARD static inline BigIntSlice bigint_slice_from_bigint(BigInt big_int) {
+	return (BigIntSlice){ .numbers = big_int.numbers, .number_count = big_int.number_count };
+}
 
-#define NULL_SLICE ((BigIntNullableSlice){ .numbers = NULL, .number_count = 0 })
+// adds big_int * (2^64)^offset to the result in place, both have to be positive and the result
+// has to be big enough to hold the sum
+static void bigint_helper_add_shifted_in_place(BigInt* result, BigInt big_int, size_t offset) {
 
-NODISCARD static inline BigIntSlice bigint_slice_from_nullable(BigIntNullableSlice big_int) {
+	ASSERT(result->positive && big_int.positive, "only positive numbers are supported");
+	ASSERT(offset + big_int.number_count <= result->number_count, "offset is out of bounds");
 
-	union {
-		BigIntSlice normal;
-		BigIntNullableSlice nullable;
-	} value = { .nullable = big_int };
+	uint64_t* const target = result->numbers + offset;
 
-	return value.normal;
-}
+	uint64_t carry = bigint_limbs_add_n(target, target, big_int.numbers, big_int.number_count);
 
-NODISCARD static inline BigIntSlice bigint_slice_from_bigint(BigInt big_int) {
-	return (BigIntSlice){ .numbers = big_int.numbers, .number_count = big_int.number_count };
+	carry = bigint_limbs_add_1(target + big_int.number_count, target + big_int.number_count,
+	                           result->number_count - offset - big_int.number_count, carry);
+
+	ASSERT(carry == 0, "The carry at the end has to be zero, otherwise we would have an overflow");
+	UNUSED(carry);
 }
 
-static void bigint_mul_two_numbers_impl(uint64_t big_int1, uint64_t big_int2, uint64_t* low,
-                                        uint64_t* high);
+NODISCARD static BigInt bigint_helper_zero_of_size(size_t number_count) {
 
-#if BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION == 0
+	BigInt result = { .positive = true, .numbers = NULL, .number_count = number_count };
 
-static void
-bigint_mul_two_numbers_impl(uint64_t big_int1, uint64_t big_int2,
-                            uint64_t* low, // NOLINT(bugprone-easily-swappable-parameters)
-                            uint64_t* high) {
+	bigint_helper_realloc_to_new_size(&result);
 
-	uint128_t result = (uint128_t)big_int1 * (uint128_t)big_int2;
+	memset(result.numbers, 0, sizeof(uint64_t) * number_count);
 
-	*low = (uint64_t)result;
-	*high =
-	    (uint64_t)(result >>
-	               64); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+	return result;
 }
 
-#else
-
-#if defined(_MSC_VER) && (defined(_M_X64) || defined(__x86_64__) || defined(__amd64__))
-
-// use fast intrinsic on x86_64 (_umul128 is only supported in msvc, as gcc / clang and linux
-// support all operations on 128 bits numbers, but that is not enabled with
-// BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION == 1)
+// this returns a non owning BigInt, that points into the slice, leading zeroes are not part of
+// the view, so that it is normalized and can be used in e.g. compare, NEVER free it
+NODISCARD static BigInt bigint_helper_view_of_slice(BigIntSlice big_int_slice) {
 
-#include <intrin.h>
+	size_t number_count = big_int_slice.number_count;
 
-static void bigint_mul_two_numbers_impl(uint64_t big_int1, uint64_t big_int2, uint64_t* low,
-                                        uint64_t* high) {
+	while(number_count > 1 && big_int_slice.numbers[number_count - 1] == 0) {
+		--number_count;
+	}
 
-	// see https://learn.microsoft.com/en-us/cpp/intrinsics/umul128?view=msvc-170
-	*low = _umul128(big_int1, big_int2, high);
+	return (BigInt){ .positive = true,
+		             .numbers = (uint64_t*)big_int_slice.numbers,
+		             .number_count = number_count };
 }
 
-#elif defined(_MSC_VER) && (defined(__aarch64__))
-
-// use fast intrinsic on aarch64 (__umulh is only supported in msvc, as gcc / clang and linux
-// support all operations on 128 bits numbers, but that is not enabled with
-// BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION == 1)
+// the kernels below get their temporary memory passed in as one scratch buffer, so that a whole
+// multiplication only needs one allocation for it, a count of 0 returns NULL
+NODISCARD static uint64_t* bigint_helper_allocate_scratch(size_t count) {
 
-#include <intrin.h>
+	if(count == 0) {
+		return NULL;
+	}
 
-static void bigint_mul_two_numbers_impl(uint64_t big_int1, uint64_t big_int2, uint64_t* low,
-                                        uint64_t* high) {
+	uint64_t* scratch = (uint64_t*)malloc(sizeof(uint64_t) * count);
 
-	*low = (uint64_t)(big_int1 * big_int2);
+	if(scratch == NULL) { // GCOVR_EXCL_BR_LINE (OOM)
+		UNREACHABLE_WITH_MSG( // GCOVR_EXCL_LINE (OOM content)
+		    "malloc failed, no error handling implemented here");
+	} // GCOVR_EXCL_LINE (OOM content)
 
-	*high = __umulh(big_int1, big_int2);
+	return scratch;
 }
 
-#else
-
-static void bigint_mul_two_numbers_impl(uint64_t big_int1, uint64_t big_int2, uint64_t* low,
-                                        uint64_t* high) {
+// 3 -> 6 -> 12 -> 24 -> 48 -> 96 correct bits
+#define DIVEXACT_INVERSE_NEWTON_STEPS 5
 
-	uint64_t b1_low = (uint32_t)(big_int1);
-	uint64_t b1_high = big_int1 >> 32;
-	uint64_t b2_low = (uint32_t)(big_int2);
-	uint64_t b2_high = big_int2 >> 32;
+// the inverse of the odd number modulo 2^64, so that number * inverse == 1 mod 2^64
+NODISCARD static uint64_t bigint_helper_inverse_of_odd_number(uint64_t number) {
 
-	uint64_t res_ll = b1_low * b2_low;
-	uint64_t res_lh = b1_low * b2_high;
-	uint64_t res_hl = b1_high * b2_low;
-	uint64_t res_hh = b1_high * b2_high;
+	ASSERT((number & 0x01) != 0, "number has to be odd");
 
-	uint64_t carry = ((res_ll >> 32) + (res_lh & 0xFFFFFFFF) + (res_hl & 0xFFFFFFFF)) >> 32;
+	// newton iteration, every step doubles the amount of correct bits, we start with 3 correct
+	// bits, as number * number == 1 mod 8 for every odd number
+	uint64_t inverse = number;
+	for(size_t i = 0; i < DIVEXACT_INVERSE_NEWTON_STEPS; ++i) {
+		inverse = inverse * (U64(2) - (number * inverse));
+	}
 
-	*low = res_ll + (res_lh << 32) + (res_hl << 32);
-	*high = res_hh + (res_lh >> 32) + (res_hl >> 32) + carry;
+	return inverse;
 }
-#endif
-#endif
 
-NODISCARD static BigInt bigint_mul_two_numbers_normal(uint64_t big_int1, uint64_t big_int2) {
+// divides big_int by divisor in place, the divisor has to be odd and the division has to be exact,
+// this uses the inverse of the divisor modulo 2^64, so no real division has to be done
+static void bigint_helper_divexact_by_odd_number_in_place(BigInt* big_int, uint64_t divisor) {
 
-	uint64_t low = U64(0);
-	uint64_t high = U64(0);
+	const uint64_t inverse = bigint_helper_inverse_of_odd_number(divisor);
 
-	bigint_mul_two_numbers_impl(big_int1, big_int2, &low, &high);
+	uint64_t borrow = U64(0);
 
-	bool need_two_numbers = high != 0;
+	for(size_t i = 0; i < big_int->number_count; ++i) {
 
-	BigInt result_big_int = { .positive = true,
-		                      .numbers = NULL,
-		                      .number_count = need_two_numbers ? 2 : 1 };
+		uint64_t value = U64(0);
+		const uint8_t local_borrow =
+		    bigint_helper_sub_uint64_with_borrow(0, big_int->numbers[i], borrow, &value);
 
-	bigint_helper_realloc_to_new_size(&result_big_int);
+		const uint64_t quotient = value * inverse;
 
-	result_big_int.numbers[0] = low;
+		big_int->numbers[i] = quotient;
 
-	if(need_two_numbers) {
-		result_big_int.numbers[1] = high;
+		uint64_t low = U64(0);
+		uint64_t high = U64(0);
+		bigint_mul_two_numbers_impl(quotient, divisor, &low, &high);
+
+		borrow = high + local_borrow;
 	}
 
-	return result_big_int;
+	ASSERT(borrow == 0, "the division was not exact");
+
+	bigint_helper_remove_leading_zeroes(big_int);
 }
 
-NODISCARD static inline BigInt bigint_mul_bigint_karatsuba_base(uint64_t big_int1,
-                                                                uint64_t big_int2) {
-	return bigint_mul_two_numbers_normal(big_int1, big_int2);
+// divides big_int by 2 in place, the division has to be exact
+static void bigint_helper_halve_exact_in_place(BigInt* big_int) {
+
+	const uint64_t shifted_out =
+	    bigint_limbs_rshift(big_int->numbers, big_int->numbers, big_int->number_count, 1);
+
+	ASSERT(shifted_out == 0, "the division was not exact");
+	UNUSED(shifted_out);
+
+	bigint_helper_remove_leading_zeroes(big_int);
 }
 
 NODISCARD static inline size_t helper_ceil_div(size_t input, size_t divider) {
 	return (input + divider - 1) / divider;
 }
 
-// NOTES: about "fake" 0 bigints:
-//  to make less memory allocations, we use bigint slices, that have NULL as numbers and count as 0,
-//  this represent 0, normally we would represent 0 by the numbers_count 0 and the first number
-//  being 0 to make this work, we need special checks in some places, where this could be used!
-// this are called "<x>_internal"
+// below this amount of numbers (of the shorter number), the schoolbook multiplication is faster
+// than karatsuba
+#ifndef BIGINT_MUL_KARATSUBA_THRESHOLD
+#define BIGINT_MUL_KARATSUBA_THRESHOLD 32
+#endif
 
-NODISCARD static inline bool bigint_mul_karatsuba_is_zero_slice(BigIntNullableSlice slice) {
-	return slice.number_count == 0 || slice.numbers == NULL;
-}
+// from this ratio of the number counts on, the longer number is cut into chunks of the size of the
+// shorter one, instead of splitting both numbers in the middle
+#ifndef BIGINT_MUL_UNBALANCED_RATIO
+#define BIGINT_MUL_UNBALANCED_RATIO 2
+#endif
 
-NODISCARD static inline BigInt bigint_helper_copy_of_slice(BigIntSlice big_int_slice) {
+// result has to have space for count1 + count2 numbers
+static void bigint_mul_schoolbook_limbs(uint64_t* result, const uint64_t* numbers1, size_t count1,
+                                        const uint64_t* numbers2, size_t count2) {
 
-	BigInt big_int = { .positive = true,
-		               .numbers = (uint64_t*)big_int_slice.numbers,
-		               .number_count = big_int_slice.number_count };
+	memset(result, 0, sizeof(uint64_t) * (count1 + count2));
 
-	return bigint_helper_get_full_copy(big_int);
+	for(size_t i = 0; i < count2; ++i) {
+		// the top limb of this row was never written before, so it can just be set
+		result[i + count1] = bigint_limbs_addmul_1(result + i, numbers1, count1, numbers2[i]);
+	}
 }
 
-NODISCARD static BigInt bigint_mul_bigint_karatsuba(BigIntSlice big_int1, BigIntSlice big_int2);
+// result[0..count) = |numbers1 - numbers2|, numbers2 has count2 <= count numbers, the rest of it
+// is treated as zero, returns true, if numbers1 < numbers2
+NODISCARD static bool bigint_helper_limbs_abs_diff(uint64_t* result, const uint64_t* numbers1,
+                                                   size_t count, const uint64_t* numbers2,
+                                                   size_t count2) {
 
-NODISCARD static inline BigInt
-bigint_mul_bigint_karatsuba_internal(BigIntNullableSlice big_int1, // NOLINT(misc-no-recursion)
-                                     BigIntNullableSlice big_int2) {
+	ASSERT(count2 <= count, "the second number can't be longer than the first one");
 
-	if(bigint_mul_karatsuba_is_zero_slice(big_int1)) {
-		return bigint_helper_zero();
+	bool numbers2_is_greater = false;
+
+	if(count2 == count) {
+		numbers2_is_greater = bigint_limbs_cmp(numbers1, numbers2, count) < 0;
+	} else {
+		bool upper_part_is_zero = true;
+		for(size_t i = count2; i < count; ++i) {
+			if(numbers1[i] != 0) {
+				upper_part_is_zero = false;
+				break;
+			}
+		}
+
+		numbers2_is_greater =
+		    upper_part_is_zero && bigint_limbs_cmp(numbers1, numbers2, count2) < 0;
 	}
 
-	if(bigint_mul_karatsuba_is_zero_slice(big_int2)) {
-		return bigint_helper_zero();
+	if(numbers2_is_greater) {
+		const uint64_t borrow = bigint_limbs_sub_n(result, numbers2, numbers1, count2);
+		memset(result + count2, 0, sizeof(uint64_t) * (count - count2));
+
+		ASSERT(borrow == 0, "the subtraction has to be in the right order");
+		UNUSED(borrow);
+
+		return true;
 	}
 
-	return bigint_mul_bigint_karatsuba(bigint_slice_from_nullable(big_int1),
-	                                   bigint_slice_from_nullable(big_int2));
+	uint64_t borrow = bigint_limbs_sub_n(result, numbers1, numbers2, count2);
+	borrow = bigint_limbs_sub_1(result + count2, numbers1 + count2, count - count2, borrow);
+
+	ASSERT(borrow == 0, "the subtraction has to be in the right order");
+	UNUSED(borrow);
+
+	return false;
 }
 
-NODISCARD static inline BigInt
-bigint_mul_bigint_karatsuba_add_internal(BigIntNullableSlice big_int1, BigIntSlice big_int2)
+// adds the karatsuba middle term z_0 + z_2 -/+ d at the offset half into result, where z_0 =
+// result[0..2 * half) and z_2 = result[2 * half..count), temp needs 2 * half + 1 numbers
+static void bigint_helper_karatsuba_add_middle(uint64_t* result, size_t count, size_t half,
+                                               const uint64_t* diff_product, bool subtract,
+                                               uint64_t* temp) {
+
+	const size_t z_2_count = count - (2 * half);
 
-{
+	{ // 1. temp = z_0 + z_2 -/+ d
 
-	if(bigint_mul_karatsuba_is_zero_slice(big_int1)) {
+		uint64_t carry = bigint_limbs_add_n(temp, result, result + (2 * half), z_2_count);
+		carry = bigint_limbs_add_1(temp + z_2_count, result + z_2_count, (2 * half) - z_2_count,
+		                           carry);
+		temp[2 * half] = carry;
 
-		// 0 + +b = +b
-		return bigint_helper_copy_of_slice(big_int2);
+		if(subtract) {
+			const uint64_t borrow = bigint_limbs_sub_n(temp, temp, diff_product, 2 * half);
+			temp[2 * half] = temp[2 * half] - borrow;
+		} else {
+			temp[2 * half] =
+			    temp[2 * half] + bigint_limbs_add_n(temp, temp, diff_product, 2 * half);
+		}
 	}
 
-	// +a + +b
+	{ // 2. result += temp * (2^64)^half, the top of temp can only be non zero, if it fits
 
-	BigInt number_a = bigint_helper_copy_of_slice(bigint_slice_from_nullable(big_int1));
-	BigInt number_b = bigint_helper_copy_of_slice(big_int2);
+		const size_t available = count - half;
+		const size_t temp_count = helper_min((2 * half) + 1, available);
 
-	BigInt result = bigint_add_bigint_both_positive(number_a, number_b);
+		ASSERT(temp_count == (2 * half) + 1 || temp[2 * half] == 0,
+		       "the middle term has to fit into the result");
 
-	free_bigint_without_reset(number_a);
-	free_bigint_without_reset(number_b);
+		uint64_t carry = bigint_limbs_add_n(result + half, result + half, temp, temp_count);
+		carry = bigint_limbs_add_1(result + half + temp_count, result + half + temp_count,
+		                           available - temp_count, carry);
 
-	return result;
+		ASSERT(carry == 0,
+		       "The carry at the end has to be zero, otherwise we would have an overflow");
+		UNUSED(carry);
+	}
 }
 
-// this adds <amount> 0 numbers to the end of the number, also known as <big_int> * (2^64)^<amount>
-static void bigint_mul_bigint_karatsuba_shift_bigint_internally_by(BigInt* big_int, size_t amount) {
+// the amount of scratch numbers, that bigint_mul_limbs needs for these counts (count1 >= count2)
+NODISCARD static size_t bigint_mul_limbs_scratch_count(size_t count1, size_t count2) {
 
-	if(amount == 0) { // GCOVR_EXCL_BR_LINE (no caller uses the 0 here)
-		return;       // GCOVR_EXCL_LINE (see above)
+	if(count2 < BIGINT_MUL_KARATSUBA_THRESHOLD) {
+		return 0;
 	}
 
-	size_t old_size = big_int->number_count;
+	const size_t half = helper_ceil_div(count1, 2);
 
-	big_int->number_count = old_size + amount;
-	bigint_helper_realloc_to_new_size(big_int);
+	if(count1 >= BIGINT_MUL_UNBALANCED_RATIO * count2 || count2 <= half) {
+		// one chunk product + the scratch of it
+		return (2 * count2) + bigint_mul_limbs_scratch_count(count2, count2);
+	}
+
+	// d, |a_0 - a_1| and |b_0 - b_1| (later reused for the middle term) + the scratch of d
+	return (4 * half) + 2 + bigint_mul_limbs_scratch_count(half, half);
+}
 
-	// move the old numbers to the right (inverse as in normal numbers), starting from the right, so
-	// this can be done in one swoop, all leftover numbers are set to 0
-	for(size_t i = big_int->number_count; i != 0; --i) {
+// result[0..count1 + count2) = numbers1 * numbers2, with count1 >= count2 >= 1, result can't
+// overlap with the inputs, scratch has to have bigint_mul_limbs_scratch_count numbers
+static void bigint_mul_limbs(uint64_t* result, // NOLINT(misc-no-recursion)
+                             const uint64_t* numbers1, size_t count1, const uint64_t* numbers2,
+                             size_t count2, uint64_t* scratch) {
 
-		if(i > amount) {
-			uint64_t number_to_move = big_int->numbers[i - amount - 1];
-			big_int->numbers[i - 1] = number_to_move;
-		} else {
-			big_int->numbers[i - 1] = U64(0);
-		}
+	ASSERT(count1 >= count2, "the arguments are in the wrong order");
+
+	// small numbers are faster with the simple algorithm, this is also the base case
+	if(count2 < BIGINT_MUL_KARATSUBA_THRESHOLD) {
+		bigint_mul_schoolbook_limbs(result, numbers1, count1, numbers2, count2);
+		return;
 	}
-}
 
-NODISCARD static inline BigInt bigint_mul_bigint_both_positive(BigInt big_int1, BigInt big_int2);
+	const size_t half = helper_ceil_div(count1, 2);
 
-NODISCARD static BigInt
-bigint_mul_bigint_karatsuba(BigIntSlice big_int1, // NOLINT(misc-no-recursion)
-                            BigIntSlice big_int2) {
+	if(count1 >= BIGINT_MUL_UNBALANCED_RATIO * count2 || count2 <= half) {
 
-	{ // check for simple bases cases e.g. * 0 or * 1
+		// karatsuba splits both numbers at the half of the longer one, so the shorter one would
+		// only consist of zeroes in the upper half, instead the longer one is cut into chunks of
+		// the size of the shorter one:
+		// (a_k * B^(k*n) + ... + a_1 * B^n + a_0) * b = (a_k * b) * B^(k*n) + ... + (a_0 * b)
+		// so that every product is a balanced one, these are then added at their offset
 
-		if(big_int1.number_count == 1) {
+		uint64_t* const product = scratch;
+		uint64_t* const product_scratch = scratch + (2 * count2);
 
-			uint64_t number = big_int1.numbers[0];
+		memset(result, 0, sizeof(uint64_t) * (count1 + count2));
 
-			if(number == 0) {
-				return bigint_helper_zero();
-			}
+		for(size_t offset = 0; offset < count1; offset += count2) {
 
-			if(number == 1) {
-				return bigint_helper_copy_of_slice(big_int2);
-			}
-		}
+			const size_t chunk_count = helper_min(count2, count1 - offset);
 
-		if(big_int2.number_count == 1) {
+			bigint_mul_limbs(product, numbers2, count2, numbers1 + offset, chunk_count,
+			                 product_scratch);
 
-			uint64_t number = big_int2.numbers[0];
+			uint64_t* const target = result + offset;
+			const size_t product_count = count2 + chunk_count;
 
-			if(number == 0) {
-				return bigint_helper_zero();
-			}
+			// a_0 * b + ... + a_i * b < B^(offset + product_count), so there is never a carry out
+			const uint64_t carry = bigint_limbs_add_n(target, target, product, product_count);
 
-			if(number == 1) {
-				return bigint_helper_copy_of_slice(big_int1);
-			}
+			ASSERT(carry == 0,
+			       "The carry at the end has to be zero, otherwise we would have an overflow");
+			UNUSED(carry);
 		}
+
+		return;
 	}
 
-	// basic algorihtm
+	// this is a divide and conquer algorithm based on en.wikipedia.org/wiki/Karatsuba_algorithm,
+	// the subtractive variant is used, as that keeps all parts at the size of the half:
+	// a * b = z_2 * B^2 + (z_0 + z_2 - (a_0 - a_1) * (b_0 - b_1)) * B + z_0
+	// with z_2 = a_1 * b_1 and z_0 = a_0 * b_0
+	// NOTE: a_1 is msb and a_0 lsb, as the numbers are stored in reverse order
+
+	uint64_t* const diff_product = scratch;
+	uint64_t* const diff1 = scratch + (2 * half);
+	uint64_t* const diff2 = diff1 + half;
+	uint64_t* const next_scratch = scratch + (4 * half) + 2;
 
-	// this is a divide and conquer algorithm based on en.wikipedia.org/wiki/Karatsuba_algorithm
+	// z_0 and z_2 are directly stored at their place in the result
+	bigint_mul_limbs(result, numbers1, half, numbers2, half, next_scratch);
 
-	// base case
-	if(big_int1.number_count == 1 && big_int2.number_count == 1) {
-		return bigint_mul_bigint_karatsuba_base(big_int1.numbers[0], big_int2.numbers[0]);
+	bigint_mul_limbs(result + (2 * half), numbers1 + half, count1 - half, numbers2 + half,
+	                 count2 - half, next_scratch);
+
+	const bool diff1_negative =
+	    bigint_helper_limbs_abs_diff(diff1, numbers1, half, numbers1 + half, count1 - half);
+	const bool diff2_negative =
+	    bigint_helper_limbs_abs_diff(diff2, numbers2, half, numbers2 + half, count2 - half);
+
+	bigint_mul_limbs(diff_product, diff1, half, diff2, half, next_scratch);
+
+	// the differences are not needed anymore, so their space is used for the middle term
+	bigint_helper_karatsuba_add_middle(result, count1 + count2, half, diff_product,
+	                                   diff1_negative == diff2_negative, diff1);
+}
+
+NODISCARD static inline BigInt
+bigint_mul_bigint_both_positive(BigInt big_int1, BigInt big_int2) {
+
+	// the first number is the longer one
+	if(big_int1.number_count < big_int2.number_count) {
+		const BigInt temp = big_int1;
+		big_int1 = big_int2;
+		big_int2 = temp;
 	}
 
-	// recursive case
+	BigInt result = { .positive = true,
+		              .numbers = NULL,
+		              .number_count = big_int1.number_count + big_int2.number_count };
 
-	{
-		size_t max_count = helper_max(big_int1.number_count, big_int2.number_count);
+	bigint_helper_realloc_to_new_size(&result);
 
-		size_t divide_at = helper_ceil_div(max_count, 2);
+	uint64_t* scratch = bigint_helper_allocate_scratch(
+	    bigint_mul_limbs_scratch_count(big_int1.number_count, big_int2.number_count));
 
-		// get the 4 parts of the numbers, the first part can be NULL, as e.g. one can be smaller as
-		// the divide_at
-		// NOTE: PAY ATTENTION to the order, as the uint64_t values are stored in reverse order! but
-		// a1 is msb and a2 lsb
+	bigint_mul_limbs(result.numbers, big_int1.numbers, big_int1.number_count, big_int2.numbers,
+	                 big_int2.number_count, scratch);
 
-		BigIntNullableSlice num_a1 = NULL_SLICE;
-		BigIntSlice num_a2 = { .numbers = big_int1.numbers, .number_count = 0 };
+	free(scratch);
 
-		if(big_int1.number_count > divide_at) {
-			num_a1 = (BigIntNullableSlice){ .numbers = big_int1.numbers + divide_at,
-				                            .number_count = big_int1.number_count - divide_at };
-			num_a2.number_count = divide_at;
+	bigint_helper_remove_leading_zeroes(&result);
 
-		} else {
-			num_a2.number_count = big_int1.number_count;
+	return result;
+}
+
+// squaring
+
+// below this amount of numbers, the schoolbook squaring is faster than karatsuba
+#ifndef BIGINT_SQR_KARATSUBA_THRESHOLD
+#define BIGINT_SQR_KARATSUBA_THRESHOLD 64
+#endif
+
+// from this amount of numbers on, the toom-3 squaring is faster than karatsuba
+#ifndef BIGINT_SQR_TOOM3_THRESHOLD
+#define BIGINT_SQR_TOOM3_THRESHOLD 200
+#endif
+
+// result has to have space for 2 * count numbers
+static void bigint_sqr_schoolbook_limbs(uint64_t* result, const uint64_t* numbers, size_t count) {
+
+	memset(result, 0, sizeof(uint64_t) * 2 * count);
+
+	{ // 1. add all cross products a[i] * a[j] with i < j, every one of them only once
+
+		for(size_t i = 0; i + 1 < count; ++i) {
+			// the top limb of this row was never written before, so it can just be set
+			result[i + count] = bigint_limbs_addmul_1(result + (2 * i) + 1, numbers + i + 1,
+			                                          count - i - 1, numbers[i]);
 		}
+	}
 
-		BigIntNullableSlice num_b1 = NULL_SLICE;
-		BigIntSlice num_b2 = { .numbers = big_int2.numbers, .number_count = 0 };
+	{ // 2. double the cross products, as every one of them appears twice in the square
 
-		if(big_int2.number_count > divide_at) {
-			num_b1 = (BigIntNullableSlice){ .numbers = big_int2.numbers + divide_at,
-				                            .number_count = big_int2.number_count - divide_at };
-			num_b2.number_count = divide_at;
+		const uint64_t shifted_out = bigint_limbs_lshift(result, result, 2 * count, 1);
 
-		} else {
-			num_b2.number_count = big_int2.number_count;
+		ASSERT(shifted_out == 0, "the doubled cross products have to fit into the result");
+		UNUSED(shifted_out);
+	}
+
+	{ // 3. add the squares a[i] * a[i] on the diagonal
+
+		uint8_t carry = 0;
+
+		for(size_t i = 0; i < count; ++i) {
+			uint64_t low = U64(0);
+			uint64_t high = U64(0);
+
+			bigint_mul_two_numbers_impl(numbers[i], numbers[i], &low, &high);
+
+			carry = bigint_helper_add_uint64_with_carry(carry, result[2 * i], low,
+			                                            &(result[2 * i]));
+			carry = bigint_helper_add_uint64_with_carry(carry, result[(2 * i) + 1], high,
+			                                            &(result[(2 * i) + 1]));
 		}
 
-		// do the necessary steps, use internal algorithm, where we could pass "fake" 0 bigint
-		// slices, see above what "fake" means
+		ASSERT(carry == 0,
+		       "The carry at the end has to be zero, otherwise we would have an overflow");
+		UNUSED(carry);
+	}
+}
+
+// the amount of scratch numbers, that bigint_sqr_limbs needs for this count
+NODISCARD static size_t bigint_sqr_limbs_scratch_count(size_t count) {
+
+	if(count < BIGINT_SQR_KARATSUBA_THRESHOLD) {
+		return 0;
+	}
+
+	const size_t half = helper_ceil_div(count, 2);
 
-		BigInt z_2 = bigint_mul_bigint_karatsuba_internal(num_a1, num_b1);
+	return (4 * half) + 2 + bigint_sqr_limbs_scratch_count(half);
+}
+
+// result[0..2 * count) = numbers^2, result can't overlap with numbers, scratch has to have
+// bigint_sqr_limbs_scratch_count numbers
+static void bigint_sqr_limbs(uint64_t* result, // NOLINT(misc-no-recursion)
+                             const uint64_t* numbers, size_t count, uint64_t* scratch) {
 
-		const BigInt z_0 = bigint_mul_bigint_karatsuba(num_a2, num_b2);
+	if(count < BIGINT_SQR_KARATSUBA_THRESHOLD) {
+		bigint_sqr_schoolbook_limbs(result, numbers, count);
+		return;
+	}
 
-		const BigInt z_1_temp1 = bigint_mul_bigint_karatsuba_add_internal(num_a1, num_a2);
+	// this is the same divide and conquer algorithm as bigint_mul_limbs, but as both numbers are
+	// the same, we only need 3 squarings of half the size and the middle term is always a
+	// subtraction:
+	// a^2 = a_1^2 * B^2 + (a_0^2 + a_1^2 - (a_0 - a_1)^2) * B + a_0^2
 
-		const BigInt z_1_temp2 = bigint_mul_bigint_karatsuba_add_internal(num_b1, num_b2);
+	const size_t half = helper_ceil_div(count, 2);
 
-		const BigInt z_1_mul_temp = bigint_mul_bigint_both_positive(z_1_temp1, z_1_temp2);
+	uint64_t* const diff_square = scratch;
+	uint64_t* const diff = scratch + (2 * half);
+	uint64_t* const next_scratch = scratch + (4 * half) + 2;
 
-		free_bigint_without_reset(z_1_temp1);
-		free_bigint_without_reset(z_1_temp2);
+	bigint_sqr_limbs(result, numbers, half, next_scratch);
 
-		const BigInt z_1_sub_temp = bigint_sub_bigint_both_positive(z_1_mul_temp, z_2);
-		ASSERT(z_1_sub_temp.positive, "result of this subtraction should always be positive!");
+	bigint_sqr_limbs(result + (2 * half), numbers + half, count - half, next_scratch);
 
-		BigInt z_1 = bigint_sub_bigint_both_positive(z_1_sub_temp, z_0);
-		ASSERT(z_1.positive, "result of this subtraction should always be positive!");
+	const bool diff_negative =
+	    bigint_helper_limbs_abs_diff(diff, numbers, half, numbers + half, count - half);
+	UNUSED(diff_negative);
 
-		// these two asserts should always hold since:
-		// (a1 + a2) * (b1 + b2) > (a1 * b1) + (a2 * b2)
-		// (a1 * b1) + (a1 * b2) + (a2 * b1) + (a2 * b2) > (a1 * b1) + (a2 * b2)
-		// (a1 * b2) + (a2 * b1) > 0
+	bigint_sqr_limbs(diff_square, diff, half, next_scratch);
 
-		free_bigint_without_reset(z_1_mul_temp);
-		free_bigint_without_reset(z_1_sub_temp);
+	bigint_helper_karatsuba_add_middle(result, 2 * count, half, diff_square, true, diff);
+}
 
-		// make the final number
+NODISCARD static BigInt bigint_sqr_impl(BigIntSlice big_int);
 
-		bigint_mul_bigint_karatsuba_shift_bigint_internally_by(&z_2, divide_at * 2);
+// sets target to the result of the operation and frees the old value of the target
+static void bigint_helper_replace(BigInt* target, BigInt new_value) {
+	free_bigint_without_reset(*target);
+	*target = new_value;
+}
 
-		bigint_mul_bigint_karatsuba_shift_bigint_internally_by(&z_1, divide_at);
+NODISCARD static BigInt bigint_sqr_toom3(BigIntSlice big_int) { // NOLINT(misc-no-recursion)
 
-		const BigInt result_add_temp = bigint_add_bigint_both_positive(z_2, z_1);
+	// toom-cook 3-way squaring, see https://en.wikipedia.org/wiki/Toom%E2%80%93Cook_multiplication
+	// the number is split into 3 parts and interpreted as polynomial p(x) = a2 * x^2 + a1 * x +
+	// a0, p(x)^2 is evaluated at the points 0, 1, -1, -2 and infinity, so only 5 squarings of a
+	// third of the size are needed, the coefficients are then recovered by interpolation
 
-		free_bigint_without_reset(z_2);
-		free_bigint_without_reset(z_1);
+	const size_t part = helper_ceil_div(big_int.number_count, 3);
 
-		BigInt result = bigint_add_bigint_both_positive(result_add_temp, z_0);
+	ASSERT(big_int.number_count > 2 * part, "the number has to be big enough to split it");
 
-		free_bigint_without_reset(result_add_temp);
-		free_bigint_without_reset(z_0);
+	const BigInt num_a0 = bigint_helper_view_of_slice(
+	    (BigIntSlice){ .numbers = big_int.numbers, .number_count = part });
+	const BigInt num_a1 = bigint_helper_view_of_slice(
+	    (BigIntSlice){ .numbers = big_int.numbers + part, .number_count = part });
+	const BigInt num_a2 = bigint_helper_view_of_slice((BigIntSlice){
+	    .numbers = big_int.numbers + (2 * part), .number_count = big_int.number_count - (2 * part) });
 
-		bigint_helper_remove_leading_zeroes(&result);
+	BigInt r_0 = bigint_sqr_impl(bigint_slice_from_bigint(num_a0));
+	BigInt r_inf = bigint_sqr_impl(bigint_slice_from_bigint(num_a2));
 
-		return result;
+	BigInt r_1 = { .positive = true, .numbers = NULL, .number_count = 0 };
+	BigInt r_m1 = { .positive = true, .numbers = NULL, .number_count = 0 };
+	BigInt r_m2 = { .positive = true, .numbers = NULL, .number_count = 0 };
+
+	{ // 1. evaluation, the values at -1 and -2 can be negative, but the sign doesn't matter, as
+	  // they get squared
+
+		BigInt temp = bigint_add_bigint(num_a0, num_a2);
+
+		// p(1) = a0 + a1 + a2
+		BigInt p_1 = bigint_add_bigint(temp, num_a1);
+
+		// p(-1) = a0 - a1 + a2
+		BigInt p_m1 = bigint_sub_bigint(temp, num_a1);
+
+		// p(-2) = 2 * (p(-1) + a2) - a0 = a0 - 2 * a1 + 4 * a2
+		bigint_helper_replace(&temp, bigint_add_bigint(p_m1, num_a2));
+		bigint_helper_replace(&temp, bigint_add_bigint(temp, temp));
+		BigInt p_m2 = bigint_sub_bigint(temp, num_a0);
+
+		free_bigint_without_reset(temp);
+
+		r_1 = bigint_sqr_impl(bigint_slice_from_bigint(p_1));
+		r_m1 = bigint_sqr_impl(bigint_slice_from_bigint(p_m1));
+		r_m2 = bigint_sqr_impl(bigint_slice_from_bigint(p_m2));
+
+		free_bigint_without_reset(p_1);
+		free_bigint_without_reset(p_m1);
+		free_bigint_without_reset(p_m2);
 	}
+
+	{ // 2. interpolation, using the sequence from Bodrato, the coefficients are c0 = r_0, c1 =
+	  // r_1, c2 = r_m1, c3 = r_m2 and c4 = r_inf afterwards
+
+		// r3 = (r(-2) - r(1)) / 3
+		bigint_helper_replace(&r_m2, bigint_sub_bigint(r_m2, r_1));
+		bigint_helper_divexact_by_odd_number_in_place(&r_m2, 3);
+
+		// r1 = (r(1) - r(-1)) / 2
+		bigint_helper_replace(&r_1, bigint_sub_bigint(r_1, r_m1));
+		bigint_helper_halve_exact_in_place(&r_1);
+
+		// r2 = r(-1) - r(0)
+		bigint_helper_replace(&r_m1, bigint_sub_bigint(r_m1, r_0));
+
+		// r3 = (r2 - r3) / 2 + 2 * r(inf)
+		bigint_helper_replace(&r_m2, bigint_sub_bigint(r_m1, r_m2));
+		bigint_helper_halve_exact_in_place(&r_m2);
+		bigint_helper_replace(&r_m2, bigint_add_bigint(r_m2, r_inf));
+		bigint_helper_replace(&r_m2, bigint_add_bigint(r_m2, r_inf));
+
+		// r2 = r2 + r1 - r(inf)
+		bigint_helper_replace(&r_m1, bigint_add_bigint(r_m1, r_1));
+		bigint_helper_replace(&r_m1, bigint_sub_bigint(r_m1, r_inf));
+
+		// r1 = r1 - r3
+		bigint_helper_replace(&r_1, bigint_sub_bigint(r_1, r_m2));
+	}
+
+	// 3. recomposition, all coefficients are positive, as they are the coefficients of the square
+	// of a polynomial with positive coefficients
+
+	BigInt result = bigint_helper_zero_of_size(2 * big_int.number_count);
+
+	bigint_helper_add_shifted_in_place(&result, r_0, 0);
+	bigint_helper_add_shifted_in_place(&result, r_1, part);
+	bigint_helper_add_shifted_in_place(&result, r_m1, 2 * part);
+	bigint_helper_add_shifted_in_place(&result, r_m2, 3 * part);
+	bigint_helper_add_shifted_in_place(&result, r_inf, 4 * part);
+
+	free_bigint_without_reset(r_0);
+	free_bigint_without_reset(r_1);
+	free_bigint_without_reset(r_m1);
+	free_bigint_without_reset(r_m2);
+	free_bigint_without_reset(r_inf);
+
+	bigint_helper_remove_leading_zeroes(&result);
+
+	return result;
 }
 
-NODISCARD static inline BigInt
-bigint_mul_bigint_both_positive(BigInt big_int1, BigInt big_int2) { // NOLINT(misc-no-recursion)
+NODISCARD static BigInt bigint_sqr_impl(BigIntSlice big_int) { // NOLINT(misc-no-recursion)
+
+	if(big_int.number_count >= BIGINT_SQR_TOOM3_THRESHOLD) {
+		return bigint_sqr_toom3(big_int);
+	}
+
+	BigInt result = { .positive = true,
+		              .numbers = NULL,
+		              .number_count = 2 * big_int.number_count };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	uint64_t* scratch =
+	    bigint_helper_allocate_scratch(bigint_sqr_limbs_scratch_count(big_int.number_count));
+
+	bigint_sqr_limbs(result.numbers, big_int.numbers, big_int.number_count, scratch);
 
-	return bigint_mul_bigint_karatsuba(bigint_slice_from_bigint(big_int1),
-	                                   bigint_slice_from_bigint(big_int2));
+	free(scratch);
+
+	bigint_helper_remove_leading_zeroes(&result);
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_sqr(BigIntC big_int) {
+
+	// (-a)^2 = a^2, so the sign can be ignored
+	return bigint_sqr_impl(bigint_slice_from_bigint(big_int));
 }
 
 NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mul_bigint(BigIntC big_int1, BigIntC big_int2) {
 
+	if(big_int1.numbers == big_int2.numbers && big_int1.number_count == big_int2.number_count) {
+		// a * a = a^2, that needs almost only half the partial products
+		BigInt result = bigint_sqr(big_int1);
+
+		// the same numbers with different signs, e.g. +a * -a = - (a^2)
+		if(big_int1.positive != big_int2.positive) {
+			bigint_negate(&result);
+		}
+
+		return result;
+	}
+
 	if(big_int1.positive) {
 		if(big_int2.positive) {
 			// +a * +b
@@ -1848,4 +2231,5990 @@ NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mul_bigint(BigIntC big_int1, BigI
 	return bigint_mul_bigint_both_positive(big_int1, big_int2);
 }
 
+// mixed operations with native numbers, these don't need a temporary bigint for the native number
+
+// returns sign * (|big_int| + value)
+NODISCARD static BigIntC bigint_helper_magnitude_add_u64(BigIntC big_int, uint64_t value,
+                                                        bool positive) {
+
+	BigIntC result = { .positive = true,
+		               .numbers = NULL,
+		               .number_count = big_int.number_count + 1 };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	result.numbers[big_int.number_count] =
+	    bigint_limbs_add_1(result.numbers, big_int.numbers, big_int.number_count, value);
+
+	bigint_helper_remove_leading_zeroes(&result);
+
+	// this keeps 0 positive
+	if(!positive) {
+		bigint_negate(&result);
+	}
+
+	return result;
+}
+
+// returns sign * (|big_int| - value)
+NODISCARD static BigIntC bigint_helper_magnitude_sub_u64(BigIntC big_int, uint64_t value,
+                                                        bool positive) {
+
+	// |big_int| < value, this is only possible, if |big_int| has only one number
+	if(big_int.number_count == 1 && big_int.numbers[0] < value) {
+
+		BigIntC result = bigint_helper_zero();
+
+		result.numbers[0] = value - big_int.numbers[0];
+
+		// the result is not 0 here, so it can just be negated
+		if(positive) {
+			bigint_negate(&result);
+		}
+
+		return result;
+	}
+
+	BigIntC result = { .positive = true,
+		               .numbers = NULL,
+		               .number_count = big_int.number_count };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	const uint64_t borrow =
+	    bigint_limbs_sub_1(result.numbers, big_int.numbers, big_int.number_count, value);
+
+	ASSERT(borrow == 0, "The borrow at the end has to be zero, otherwise we would have an overflow");
+	UNUSED(borrow);
+
+	bigint_helper_remove_leading_zeroes(&result);
+
+	// this keeps 0 positive
+	if(!positive) {
+		bigint_negate(&result);
+	}
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_add_u64(BigIntC big_int, uint64_t value) {
+
+	if(big_int.positive) {
+		// +a + b = + (|a| + b)
+		return bigint_helper_magnitude_add_u64(big_int, value, true);
+	}
+
+	// -a + b = - (|a| - b)
+	return bigint_helper_magnitude_sub_u64(big_int, value, false);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_sub_u64(BigIntC big_int, uint64_t value) {
+
+	if(big_int.positive) {
+		// +a - b = + (|a| - b)
+		return bigint_helper_magnitude_sub_u64(big_int, value, true);
+	}
+
+	// -a - b = - (|a| + b)
+	return bigint_helper_magnitude_add_u64(big_int, value, false);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_add_i64(BigIntC big_int, int64_t value) {
+
+	if(value >= 0LL) {
+		return bigint_add_u64(big_int, (uint64_t)value);
+	}
+
+	// a + -b = a - +b
+	return bigint_sub_u64(big_int, helper_unsigned_abs(value));
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_sub_i64(BigIntC big_int, int64_t value) {
+
+	if(value >= 0LL) {
+		return bigint_sub_u64(big_int, (uint64_t)value);
+	}
+
+	// a - -b = a + +b
+	return bigint_add_u64(big_int, helper_unsigned_abs(value));
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mul_u64(BigIntC big_int, uint64_t value) {
+
+	BigIntC result = { .positive = true,
+		               .numbers = NULL,
+		               .number_count = big_int.number_count + 1 };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	result.numbers[big_int.number_count] =
+	    bigint_limbs_mul_1(result.numbers, big_int.numbers, big_int.number_count, value);
+
+	bigint_helper_remove_leading_zeroes(&result);
+
+	// this keeps 0 positive
+	if(!big_int.positive) {
+		bigint_negate(&result);
+	}
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mul_i64(BigIntC big_int, int64_t value) {
+
+	BigIntC result = bigint_mul_u64(big_int, helper_unsigned_abs(value));
+
+	// a * -b = - (a * +b)
+	if(value < 0LL) {
+		bigint_negate(&result);
+	}
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED bool bigint_eq_u64(BigIntC big_int, uint64_t value) {
+	return big_int.positive && big_int.number_count == 1 && big_int.numbers[0] == value;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED bool bigint_eq_i64(BigIntC big_int, int64_t value) {
+
+	if(value >= 0LL) {
+		return bigint_eq_u64(big_int, (uint64_t)value);
+	}
+
+	return !big_int.positive && big_int.number_count == 1 &&
+	       big_int.numbers[0] == helper_unsigned_abs(value);
+}
+
+// compares |big_int| with value
+NODISCARD static int8_t bigint_helper_magnitude_cmp_u64(BigIntC big_int, uint64_t value) {
+
+	if(big_int.number_count > 1) {
+		// only valid, if normalized (no leading zeros)
+		return CMP_FIRST_ONE_IS_GREATER;
+	}
+
+	return bigint_limbs_cmp(big_int.numbers, &value, 1);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED int8_t bigint_cmp_u64(BigIntC big_int, uint64_t value) {
+
+	if(!big_int.positive) {
+		// -a < +b, -0 doesn't exist
+		return CMP_FIRST_ONE_IS_LESS;
+	}
+
+	return bigint_helper_magnitude_cmp_u64(big_int, value);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED int8_t bigint_cmp_i64(BigIntC big_int, int64_t value) {
+
+	if(value >= 0LL) {
+		return bigint_cmp_u64(big_int, (uint64_t)value);
+	}
+
+	if(big_int.positive) {
+		// +a > -b
+		return CMP_FIRST_ONE_IS_GREATER;
+	}
+
+	//-a <=> -b ==  cmp_reverse (+a <=> +b)
+	return cmp_reverse(bigint_helper_magnitude_cmp_u64(big_int, helper_unsigned_abs(value)));
+}
+
+// shifts
+
+// the amount of bits of |big_int|, 0 has 0 bits
+NODISCARD static size_t bigint_helper_bit_length(BigIntC big_int) {
+
+	const uint64_t last_number = big_int.numbers[big_int.number_count - 1];
+
+	if(last_number == 0) {
+		return 0;
+	}
+
+	return ((big_int.number_count - 1) * NUMBER_BIT_COUNT) +
+	       bigint_helper_bits_of_number_used(last_number);
+}
+
+// returns |big_int| * 2^amount
+NODISCARD static BigIntC bigint_helper_shift_left(BigIntC big_int, size_t amount) {
+
+	const size_t number_offset = amount / NUMBER_BIT_COUNT;
+
+	BigIntC result = { .positive = true,
+		               .numbers = NULL,
+		               .number_count = big_int.number_count + number_offset + 1 };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	memset(result.numbers, 0, sizeof(uint64_t) * number_offset);
+
+	result.numbers[result.number_count - 1] =
+	    bigint_limbs_lshift(result.numbers + number_offset, big_int.numbers, big_int.number_count,
+	                        (unsigned int)(amount % NUMBER_BIT_COUNT));
+
+	bigint_helper_remove_leading_zeroes(&result);
+
+	return result;
+}
+
+// returns floor(|big_int| / 2^amount)
+NODISCARD static BigIntC bigint_helper_shift_right(BigIntC big_int, size_t amount) {
+
+	const size_t number_offset = amount / NUMBER_BIT_COUNT;
+
+	if(number_offset >= big_int.number_count) {
+		return bigint_helper_zero();
+	}
+
+	BigIntC result = { .positive = true,
+		               .numbers = NULL,
+		               .number_count = big_int.number_count - number_offset };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	const uint64_t shifted_out =
+	    bigint_limbs_rshift(result.numbers, big_int.numbers + number_offset, result.number_count,
+	                        (unsigned int)(amount % NUMBER_BIT_COUNT));
+	UNUSED(shifted_out);
+
+	bigint_helper_remove_leading_zeroes(&result);
+
+	return result;
+}
+
+// returns true, if any of the lowest amount bits of |big_int| is set
+NODISCARD static bool bigint_helper_has_bits_below(BigIntC big_int, size_t amount) {
+
+	const size_t number_offset = amount / NUMBER_BIT_COUNT;
+
+	for(size_t i = 0; i < number_offset && i < big_int.number_count; ++i) {
+		if(big_int.numbers[i] != 0) {
+			return true;
+		}
+	}
+
+	if(number_offset >= big_int.number_count) {
+		return false;
+	}
+
+	const uint64_t mask = (U64(1) << (amount % NUMBER_BIT_COUNT)) - 1;
+
+	return (big_int.numbers[number_offset] & mask) != 0;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_shl(BigIntC big_int, size_t amount) {
+
+	BigIntC result = bigint_helper_shift_left(big_int, amount);
+
+	if(!big_int.positive) {
+		bigint_negate(&result);
+	}
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_shr(BigIntC big_int, size_t amount) {
+
+	BigIntC result = bigint_helper_shift_right(big_int, amount);
+
+	if(big_int.positive) {
+		return result;
+	}
+
+	// the shift rounds towards negative infinity, so for negative numbers the magnitude is
+	// rounded up, if any bit was shifted out
+	if(bigint_helper_has_bits_below(big_int, amount)) {
+		bigint_helper_replace(&result, bigint_add_u64(result, 1));
+	}
+
+	bigint_negate(&result);
+
+	return result;
+}
+
+BIGINT_C_LIB_EXPORTED void bigint_shl_in_place(BigIntC* big_int, size_t amount) {
+
+	const size_t old_count = big_int->number_count;
+
+	if(amount == 0 || (old_count == 1 && big_int->numbers[0] == 0)) {
+		return;
+	}
+
+	const size_t number_offset = amount / NUMBER_BIT_COUNT;
+
+	// realloc grows the allocation in place, if there is space behind it, so the numbers are only
+	// moved by the allocator, if they have to be
+	big_int->number_count = old_count + number_offset + 1;
+	bigint_helper_realloc_to_new_size(big_int);
+
+	// the shift goes from the top to the bottom, so the target can be above the source
+	big_int->numbers[old_count + number_offset] =
+	    bigint_limbs_lshift(big_int->numbers + number_offset, big_int->numbers, old_count,
+	                        (unsigned int)(amount % NUMBER_BIT_COUNT));
+
+	memset(big_int->numbers, 0, sizeof(uint64_t) * number_offset);
+
+	bigint_helper_remove_leading_zeroes(big_int);
+}
+
+BIGINT_C_LIB_EXPORTED void bigint_shr_in_place(BigIntC* big_int, size_t amount) {
+
+	if(amount == 0) {
+		return;
+	}
+
+	const bool round_up = !big_int->positive && bigint_helper_has_bits_below(*big_int, amount);
+
+	const size_t number_offset = amount / NUMBER_BIT_COUNT;
+
+	if(number_offset >= big_int->number_count) {
+		big_int->number_count = 1;
+		big_int->numbers[0] = 0;
+	} else {
+		big_int->number_count = big_int->number_count - number_offset;
+
+		// the shift goes from the bottom to the top, so the target can be below the source
+		const uint64_t shifted_out =
+		    bigint_limbs_rshift(big_int->numbers, big_int->numbers + number_offset,
+		                        big_int->number_count, (unsigned int)(amount % NUMBER_BIT_COUNT));
+		UNUSED(shifted_out);
+	}
+
+	const bool positive = big_int->positive;
+	big_int->positive = true;
+
+	bigint_helper_remove_leading_zeroes(big_int);
+
+	if(round_up) {
+		const uint64_t carry =
+		    bigint_limbs_add_1(big_int->numbers, big_int->numbers, big_int->number_count, 1);
+
+		if(carry != 0) {
+			big_int->number_count = big_int->number_count + 1;
+			bigint_helper_realloc_to_new_size(big_int);
+			big_int->numbers[big_int->number_count - 1] = carry;
+		}
+	}
+
+	if(!positive) {
+		bigint_negate(big_int);
+	}
+}
+
+// bitwise operations, these behave like the numbers were stored in two's complement with an
+// infinite amount of bits, so -1 has all bits set and negative numbers have infinitely many ones on
+// top, the two's complement of negative operands is computed on the fly, number by number
+
+// the operation is ((a & b) & and_mask) | ((a ^ b) & xor_mask), so that all of them can share the
+// same loops without a branch per number
+typedef struct {
+	uint64_t and_mask;
+	uint64_t xor_mask;
+} BitwiseOperation;
+
+#define BITWISE_OPERATION_AND ((BitwiseOperation){ .and_mask = ~U64(0), .xor_mask = U64(0) })
+#define BITWISE_OPERATION_OR ((BitwiseOperation){ .and_mask = ~U64(0), .xor_mask = ~U64(0) })
+#define BITWISE_OPERATION_XOR ((BitwiseOperation){ .and_mask = U64(0), .xor_mask = ~U64(0) })
+
+NODISCARD static inline uint64_t helper_bitwise_apply(BitwiseOperation operation, uint64_t number1,
+                                                      uint64_t number2) {
+	return ((number1 & number2) & operation.and_mask) | ((number1 ^ number2) & operation.xor_mask);
+}
+
+// the index of the lowest number, that isn't 0, big_int can't be 0
+NODISCARD static size_t bigint_helper_lowest_non_zero_index(BigIntC big_int) {
+
+	size_t index = 0;
+
+	while(big_int.numbers[index] == 0) {
+		++index;
+	}
+
+	ASSERT(index < big_int.number_count, "big_int can't be 0");
+
+	return index;
+}
+
+// the number at index of the two's complement of big_int, lowest_non_zero has to be the index of
+// its lowest non zero number, if it is negative, below that the two's complement is 0, at that
+// index it's the negated number and above it the inverted one
+NODISCARD static inline uint64_t bigint_helper_twos_complement_number(BigIntC big_int,
+                                                                      size_t lowest_non_zero,
+                                                                      size_t index) {
+
+	if(big_int.positive) {
+		return index < big_int.number_count ? big_int.numbers[index] : U64(0);
+	}
+
+	if(index < lowest_non_zero) {
+		return U64(0);
+	}
+
+	if(index == lowest_non_zero) {
+		return U64(0) - big_int.numbers[index];
+	}
+
+	return index < big_int.number_count ? ~big_int.numbers[index] : ~U64(0);
+}
+
+NODISCARD static BigIntC bigint_helper_bitwise(BigIntC big_int1, BigIntC big_int2,
+                                               BitwiseOperation operation) {
+
+	// the infinitely repeated top number of the two's complement
+	const uint64_t extension1 = big_int1.positive ? U64(0) : ~U64(0);
+	const uint64_t extension2 = big_int2.positive ? U64(0) : ~U64(0);
+
+	const bool positive = helper_bitwise_apply(operation, extension1, extension2) == 0;
+
+	const size_t max_count = big_int1.number_count > big_int2.number_count
+	                             ? big_int1.number_count
+	                             : big_int2.number_count;
+
+	// a negative result can need one number more, e.g. -1 - 2^64 for (-2) & (-2^64 + 1), an and
+	// with a positive number is never greater than that number
+	size_t count = max_count + 1;
+
+	if(operation.xor_mask == 0) {
+		if(big_int1.positive && big_int1.number_count < count) {
+			count = big_int1.number_count;
+		}
+
+		if(big_int2.positive && big_int2.number_count < count) {
+			count = big_int2.number_count;
+		}
+	}
+
+	BigIntC result = { .positive = true, .numbers = NULL, .number_count = count };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	// below this index, the negative operands need the special cases of the two's complement, above
+	// it, it's just the inverted number
+	size_t head = 0;
+	size_t lowest_non_zero1 = 0;
+	size_t lowest_non_zero2 = 0;
+
+	if(!big_int1.positive) {
+		lowest_non_zero1 = bigint_helper_lowest_non_zero_index(big_int1);
+		head = lowest_non_zero1 + 1;
+	}
+
+	if(!big_int2.positive) {
+		lowest_non_zero2 = bigint_helper_lowest_non_zero_index(big_int2);
+		head = lowest_non_zero2 + 1 > head ? lowest_non_zero2 + 1 : head;
+	}
+
+	head = head < count ? head : count;
+
+	const size_t common_count = big_int1.number_count < big_int2.number_count
+	                                ? big_int1.number_count
+	                                : big_int2.number_count;
+
+	const BigIntC longer = big_int1.number_count < big_int2.number_count ? big_int2 : big_int1;
+	const uint64_t longer_extension = longer.positive ? U64(0) : ~U64(0);
+	const uint64_t shorter_extension =
+	    big_int1.number_count < big_int2.number_count ? extension1 : extension2;
+
+	const size_t longer_end = max_count < count ? max_count : count;
+
+	{ // 1. the numbers up to the lowest non zero numbers of the negative operands
+
+		for(size_t i = 0; i < head; ++i) {
+			result.numbers[i] = helper_bitwise_apply(
+			    operation, bigint_helper_twos_complement_number(big_int1, lowest_non_zero1, i),
+			    bigint_helper_twos_complement_number(big_int2, lowest_non_zero2, i));
+		}
+	}
+
+	{ // 2. the numbers, that both operands have, these loops have no branches, so that the
+	  // compiler can vectorize them
+
+		const size_t end = common_count < count ? common_count : count;
+
+		for(size_t i = head; i < end; ++i) {
+			result.numbers[i] =
+			    helper_bitwise_apply(operation, big_int1.numbers[i] ^ extension1,
+			                         big_int2.numbers[i] ^ extension2);
+		}
+	}
+
+	{ // 3. the numbers, that only the longer operand has
+
+		const size_t start = head > common_count ? head : common_count;
+
+		for(size_t i = start; i < longer_end; ++i) {
+			result.numbers[i] = helper_bitwise_apply(
+			    operation, longer.numbers[i] ^ longer_extension, shorter_extension);
+		}
+	}
+
+	{ // 4. the numbers above both operands
+
+		const size_t start = head > longer_end ? head : longer_end;
+
+		for(size_t i = start; i < count; ++i) {
+			result.numbers[i] = helper_bitwise_apply(operation, extension1, extension2);
+		}
+	}
+
+	// 5. a negative result is stored in two's complement, so it has to be negated back into the
+	// magnitude, the same way as the operands
+	if(!positive) {
+
+		size_t index = 0;
+
+		while(result.numbers[index] == 0) {
+			++index;
+		}
+
+		result.numbers[index] = U64(0) - result.numbers[index];
+
+		for(++index; index < count; ++index) {
+			result.numbers[index] = ~result.numbers[index];
+		}
+	}
+
+	bigint_helper_remove_leading_zeroes(&result);
+
+	if(!positive) {
+		bigint_negate(&result);
+	}
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_and(BigIntC big_int1, BigIntC big_int2) {
+	return bigint_helper_bitwise(big_int1, big_int2, BITWISE_OPERATION_AND);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_or(BigIntC big_int1, BigIntC big_int2) {
+	return bigint_helper_bitwise(big_int1, big_int2, BITWISE_OPERATION_OR);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_xor(BigIntC big_int1, BigIntC big_int2) {
+	return bigint_helper_bitwise(big_int1, big_int2, BITWISE_OPERATION_XOR);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_not(BigIntC big_int) {
+
+	// in two's complement ~x = -x - 1
+	bigint_negate(&big_int);
+
+	return bigint_sub_u64(big_int, 1);
+}
+
+// bit queries and manipulation, the bit length and the amount of set bits are the ones of the
+// absolute value, the single bits are the ones of the two's complement, like for the bitwise
+// operations
+
+NODISCARD BIGINT_C_LIB_EXPORTED size_t bigint_bit_length(BigIntC big_int) {
+	return bigint_helper_bit_length(big_int);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED size_t bigint_popcount(BigIntC big_int) {
+
+	size_t result = 0;
+
+	for(size_t i = 0; i < big_int.number_count; ++i) {
+		result += helper_popcount(big_int.numbers[i]);
+	}
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED size_t bigint_ctz(BigIntC big_int) {
+
+	for(size_t i = 0; i < big_int.number_count; ++i) {
+		if(big_int.numbers[i] != 0) {
+			return (i * NUMBER_BIT_COUNT) + helper_count_trailing_zeros(big_int.numbers[i]);
+		}
+	}
+
+	return 0;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED bool bigint_test_bit(BigIntC big_int, size_t index) {
+
+	const size_t number_index = index / NUMBER_BIT_COUNT;
+
+	uint64_t number = U64(0);
+
+	if(big_int.positive) {
+		if(number_index >= big_int.number_count) {
+			return false;
+		}
+
+		number = big_int.numbers[number_index];
+	} else {
+		number = bigint_helper_twos_complement_number(
+		    big_int, bigint_helper_lowest_non_zero_index(big_int), number_index);
+	}
+
+	return ((number >> (index % NUMBER_BIT_COUNT)) & 0x01) != 0;
+}
+
+// sets or clears the bit at index of big_int, which has to be positive
+static void bigint_helper_change_bit_of_magnitude(BigIntC* big_int, size_t index, bool set) {
+
+	ASSERT(big_int->positive, "only the bits of positive numbers can be changed directly");
+
+	const size_t number_index = index / NUMBER_BIT_COUNT;
+	const uint64_t mask = U64(1) << (index % NUMBER_BIT_COUNT);
+
+	if(number_index >= big_int->number_count) {
+		if(!set) {
+			return;
+		}
+
+		// only grow, if the bit is above the top number
+		const size_t old_count = big_int->number_count;
+
+		big_int->number_count = number_index + 1;
+		bigint_helper_realloc_to_new_size(big_int);
+
+		memset(big_int->numbers + old_count, 0, sizeof(uint64_t) * (number_index - old_count));
+
+		big_int->numbers[number_index] = mask;
+		return;
+	}
+
+	if(set) {
+		big_int->numbers[number_index] |= mask;
+		return;
+	}
+
+	big_int->numbers[number_index] &= ~mask;
+
+	if(number_index == big_int->number_count - 1) {
+		bigint_helper_remove_leading_zeroes(big_int);
+	}
+}
+
+// the bits of a negative big_int -x in two's complement are the inverted bits of x - 1, so setting a
+// bit of it is clearing the bit of x - 1 and the other way around
+static void bigint_helper_change_bit(BigIntC* big_int, size_t index, bool set) {
+
+	if(big_int->positive) {
+		bigint_helper_change_bit_of_magnitude(big_int, index, set);
+		return;
+	}
+
+	big_int->positive = true;
+
+	{ // 1. x - 1, x is at least 1, so this can't borrow out of the top
+		const uint64_t borrow =
+		    bigint_limbs_sub_1(big_int->numbers, big_int->numbers, big_int->number_count, 1);
+		UNUSED(borrow);
+		ASSERT(borrow == 0, "x can't be 0, if it is negative");
+
+		bigint_helper_remove_leading_zeroes(big_int);
+	}
+
+	bigint_helper_change_bit_of_magnitude(big_int, index, !set);
+
+	{ // 2. add the 1 back, this can only grow, if the top number was all ones
+		const uint64_t carry =
+		    bigint_limbs_add_1(big_int->numbers, big_int->numbers, big_int->number_count, 1);
+
+		if(carry != 0) {
+			big_int->number_count = big_int->number_count + 1;
+			bigint_helper_realloc_to_new_size(big_int);
+			big_int->numbers[big_int->number_count - 1] = carry;
+		}
+	}
+
+	bigint_negate(big_int);
+}
+
+BIGINT_C_LIB_EXPORTED void bigint_set_bit(BigIntC* big_int, size_t index) {
+	bigint_helper_change_bit(big_int, index, true);
+}
+
+BIGINT_C_LIB_EXPORTED void bigint_clear_bit(BigIntC* big_int, size_t index) {
+	bigint_helper_change_bit(big_int, index, false);
+}
+
+// division
+
+// returns (high * 2^64 + low) / divisor and sets the remainder, high has to be less than the
+// divisor, so that the quotient fits into one number, this is only used for precomputing the
+// reciprocal, so it doesn't need to be fast
+NODISCARD static uint64_t bigint_helper_div_2_by_1_slow(uint64_t high, uint64_t low,
+                                                        uint64_t divisor, uint64_t* remainder) {
+
+	ASSERT(high < divisor, "the quotient has to fit into one number");
+
+#if BIGINT_C_UNDERLYING_COMPUTATION_IMPLEMENTATION == 0
+
+	const uint128_t dividend = ((uint128_t)high << NUMBER_BIT_COUNT) | (uint128_t)low;
+
+	*remainder = (uint64_t)(dividend % divisor);
+
+	return (uint64_t)(dividend / divisor);
+#else
+
+	// bitwise restoring division, the remainder always stays less than the divisor
+	uint64_t quotient = U64(0);
+	uint64_t rest = high;
+
+	for(size_t i = 0; i < NUMBER_BIT_COUNT; ++i) {
+		const bool overflow = (rest >> (NUMBER_BIT_COUNT - 1)) != 0;
+
+		rest = (rest << 1) | ((low >> (NUMBER_BIT_COUNT - 1 - i)) & 0x01);
+		quotient = quotient << 1;
+
+		if(overflow || rest >= divisor) {
+			rest = rest - divisor;
+			quotient = quotient | 0x01;
+		}
+	}
+
+	*remainder = rest;
+
+	return quotient;
+#endif
+}
+
+// the reciprocal of a normalized divisor (highest bit set), this is floor((2^128 - 1) / divisor)
+// - 2^64, see "Improved division by invariant integers" by Möller and Granlund
+NODISCARD static uint64_t bigint_helper_reciprocal_of_number(uint64_t divisor) {
+
+	ASSERT((divisor >> (NUMBER_BIT_COUNT - 1)) != 0, "the divisor has to be normalized");
+
+	uint64_t remainder = U64(0);
+
+	// (2^128 - 1) - 2^64 * divisor = (2^64 - 1 - divisor) * 2^64 + (2^64 - 1)
+	return bigint_helper_div_2_by_1_slow(~divisor, ~U64(0), divisor, &remainder);
+}
+
+// returns (high * 2^64 + low) / divisor and sets the remainder, the divisor has to be
+// normalized, the reciprocal the one of bigint_helper_reciprocal_of_number and high less than the
+// divisor, this needs two multiplications instead of one division, see algorithm 4 in "Improved
+// division by invariant integers" by Möller and Granlund
+NODISCARD static inline uint64_t bigint_helper_div_2_by_1_preinv(uint64_t high, uint64_t low,
+                                                                 uint64_t divisor,
+                                                                 uint64_t reciprocal,
+                                                                 uint64_t* remainder) {
+
+	ASSERT(high < divisor, "the quotient has to fit into one number");
+
+	uint64_t quotient_low = U64(0);
+	uint64_t quotient = U64(0);
+
+	bigint_mul_two_numbers_impl(reciprocal, high, &quotient_low, &quotient);
+
+	const uint8_t carry = bigint_helper_add_uint64_with_carry(0, quotient_low, low, &quotient_low);
+	quotient = quotient + high + 1 + carry;
+
+	uint64_t rest = low - (quotient * divisor);
+
+	if(rest > quotient_low) {
+		--quotient;
+		rest = rest + divisor;
+	}
+
+	if(rest >= divisor) { // GCOVR_EXCL_BR_LINE (this is very unlikely)
+		++quotient;       // GCOVR_EXCL_LINE (see above)
+		rest = rest - divisor; // GCOVR_EXCL_LINE (see above)
+	}
+
+	*remainder = rest;
+
+	return quotient;
+}
+
+// quotient[0..count) = numbers / (divisor >> shift), returns the remainder, the divisor has to be
+// normalized (shifted left by shift) and the reciprocal has to be the one of it, quotient can be
+// the same as numbers or NULL, if only the remainder is needed
+NODISCARD static uint64_t bigint_helper_limbs_divrem_1_preinv(uint64_t* quotient,
+                                                              const uint64_t* numbers,
+                                                              size_t count, uint64_t divisor,
+                                                              size_t shift, uint64_t reciprocal) {
+
+	// the dividend is shifted by the same amount as the divisor on the fly, the bits shifted out at
+	// the top are the start of the remainder, they are always less than the divisor
+	uint64_t remainder =
+	    shift == 0 ? U64(0) : numbers[count - 1] >> (NUMBER_BIT_COUNT - shift);
+
+	for(size_t i = count; i != 0; --i) {
+
+		uint64_t low = numbers[i - 1] << shift;
+
+		if(shift != 0 && i > 1) {
+			low = low | (numbers[i - 2] >> (NUMBER_BIT_COUNT - shift));
+		}
+
+		const uint64_t quotient_number =
+		    bigint_helper_div_2_by_1_preinv(remainder, low, divisor, reciprocal, &remainder);
+
+		if(quotient != NULL) {
+			quotient[i - 1] = quotient_number;
+		}
+	}
+
+	return remainder >> shift;
+}
+
+// division by a single number with a precomputed reciprocal, that is reused for every division
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntDivisorU64 bigint_divisor_u64_from_number(uint64_t divisor) {
+
+	if(divisor == 0) {
+		UNREACHABLE_WITH_MSG("division by zero");
+	}
+
+	const size_t shift = helper_count_leading_zeros(divisor);
+	const uint64_t normalized = divisor << shift;
+
+	return (BigIntDivisorU64){ .divisor = divisor,
+		                       .normalized = normalized,
+		                       .reciprocal = bigint_helper_reciprocal_of_number(normalized),
+		                       .shift = shift };
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_divrem_1_pre(uint64_t* quotient,
+                                                                   const uint64_t* numbers,
+                                                                   size_t count,
+                                                                   BigIntDivisorU64 divisor) {
+
+	if(count == 0) {
+		return U64(0);
+	}
+
+	return bigint_helper_limbs_divrem_1_preinv(quotient, numbers, count, divisor.normalized,
+	                                           divisor.shift, divisor.reciprocal);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntDivModU64C bigint_divmod_u64_pre(BigIntC dividend,
+                                                                       BigIntDivisorU64 divisor) {
+
+	BigIntDivModU64C result = {
+		.quotient = { .positive = true, .numbers = NULL, .number_count = dividend.number_count },
+		.remainder = U64(0)
+	};
+
+	bigint_helper_realloc_to_new_size(&(result.quotient));
+
+	result.remainder = bigint_limbs_divrem_1_pre(result.quotient.numbers, dividend.numbers,
+	                                             dividend.number_count, divisor);
+
+	bigint_helper_remove_leading_zeroes(&(result.quotient));
+
+	// the quotient is truncated, so it has the sign of the dividend, as the divisor is positive
+	if(!dividend.positive) {
+		bigint_negate(&(result.quotient));
+	}
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_mod_u64_pre(BigIntC dividend,
+                                                            BigIntDivisorU64 divisor) {
+
+	return bigint_limbs_divrem_1_pre(NULL, dividend.numbers, dividend.number_count, divisor);
+}
+
+// the schoolbook long division (algorithm D from Knuth, "The Art of Computer Programming", volume
+// 2, section 4.3.1), numbers has count + 1 numbers and gets replaced by the remainder in its lower
+// divisor_count numbers, quotient gets count - divisor_count + 1 numbers, the divisor has to be
+// normalized (highest bit set) and has at least 2 numbers
+static void bigint_helper_limbs_divrem_knuth(uint64_t* quotient, uint64_t* numbers, size_t count,
+                                             const uint64_t* divisor, size_t divisor_count) {
+
+	ASSERT(divisor_count >= 2, "the divisor has to have at least 2 numbers");
+	ASSERT(count >= divisor_count, "the dividend has to be at least as long as the divisor");
+
+	const uint64_t divisor_high = divisor[divisor_count - 1];
+	const uint64_t divisor_second = divisor[divisor_count - 2];
+
+	const uint64_t reciprocal = bigint_helper_reciprocal_of_number(divisor_high);
+
+	for(size_t j = count - divisor_count + 1; j != 0; --j) {
+
+		uint64_t* const current = numbers + (j - 1);
+
+		const uint64_t current_high = current[divisor_count];
+		const uint64_t current_second = current[divisor_count - 1];
+
+		uint64_t estimate = U64(0);
+		uint64_t rest = U64(0);
+		bool rest_overflowed = false;
+
+		{ // 1. estimate the quotient number from the top two numbers, this is at most 2 too big
+
+			if(current_high >= divisor_high) {
+				// the top can only be equal, the quotient number is then at most 2^64 - 1
+				estimate = ~U64(0);
+				rest_overflowed =
+				    bigint_helper_add_uint64_with_carry(0, current_second, divisor_high, &rest) !=
+				    0;
+			} else {
+				estimate = bigint_helper_div_2_by_1_preinv(current_high, current_second,
+				                                           divisor_high, reciprocal, &rest);
+			}
+		}
+
+		{ // 2. correct the estimate with the second number of the divisor, afterwards it is at most
+		  // 1 too big
+
+			while(!rest_overflowed) {
+				uint64_t product_low = U64(0);
+				uint64_t product_high = U64(0);
+
+				bigint_mul_two_numbers_impl(estimate, divisor_second, &product_low, &product_high);
+
+				if(product_high < rest ||
+				   (product_high == rest && product_low <= current[divisor_count - 2])) {
+					break;
+				}
+
+				--estimate;
+				rest_overflowed =
+				    bigint_helper_add_uint64_with_carry(0, rest, divisor_high, &rest) != 0;
+			}
+		}
+
+		{ // 3. subtract estimate * divisor and add the divisor back, if it was still too big
+
+			const uint64_t borrow = bigint_limbs_submul_1(current, divisor, divisor_count, estimate);
+
+			const bool negative = current_high < borrow;
+			current[divisor_count] = current_high - borrow;
+
+			if(negative) { // GCOVR_EXCL_BR_LINE (this is very unlikely)
+				--estimate; // GCOVR_EXCL_LINE (see above)
+				const uint64_t carry = // GCOVR_EXCL_LINE (see above)
+				    bigint_limbs_add_n(current, current, divisor, divisor_count);
+				current[divisor_count] = current[divisor_count] + carry; // GCOVR_EXCL_LINE
+			}
+		}
+
+		quotient[j - 1] = estimate;
+	}
+}
+
+// below this amount of numbers of the divisor, the schoolbook division is faster than the
+// recursive one
+#ifndef BIGINT_DIV_RECURSIVE_THRESHOLD
+#define BIGINT_DIV_RECURSIVE_THRESHOLD 60
+#endif
+
+// the recursion has to end in a schoolbook division with at least 2 numbers in the divisor
+#if BIGINT_DIV_RECURSIVE_THRESHOLD < 4
+#error "BIGINT_DIV_RECURSIVE_THRESHOLD has to be at least 4"
+#endif
+
+// the same as bigint_helper_limbs_divrem_knuth, but numbers has only count numbers, the top
+// divisor_count numbers don't need to be less than the divisor, the quotient gets count -
+// divisor_count numbers and the highest quotient number (0 or 1) is returned
+NODISCARD static uint64_t bigint_helper_limbs_divrem_schoolbook(uint64_t* quotient,
+                                                                uint64_t* numbers, size_t count,
+                                                                const uint64_t* divisor,
+                                                                size_t divisor_count) {
+
+	uint64_t* const top = numbers + (count - divisor_count);
+
+	uint64_t quotient_high = U64(0);
+
+	// as the divisor is normalized, the top numbers are less than 2 * divisor
+	if(bigint_limbs_cmp(top, divisor, divisor_count) >= 0) {
+		const uint64_t borrow = bigint_limbs_sub_n(top, top, divisor, divisor_count);
+		ASSERT(borrow == 0, "the subtraction has to be in the right order");
+		UNUSED(borrow);
+
+		quotient_high = U64(1);
+	}
+
+	if(count > divisor_count) {
+		bigint_helper_limbs_divrem_knuth(quotient, numbers, count - 1, divisor, divisor_count);
+	}
+
+	return quotient_high;
+}
+
+// the amount of scratch numbers, that bigint_helper_limbs_divrem_recursive needs for this count
+NODISCARD static size_t bigint_div_recursive_scratch_count(size_t count) {
+
+	if(count < BIGINT_DIV_RECURSIVE_THRESHOLD) {
+		return 0;
+	}
+
+	const size_t low_count = count / 2;
+	const size_t high_count = count - low_count;
+
+	// the product of the quotient half and the divisor half + the scratch of that multiplication,
+	// the recursive calls are done before, so they can use the same space
+	const size_t mul_scratch = count + bigint_mul_limbs_scratch_count(high_count, low_count);
+	const size_t recursive_scratch = bigint_div_recursive_scratch_count(high_count);
+
+	return mul_scratch > recursive_scratch ? mul_scratch : recursive_scratch;
+}
+
+// the recursive division from Burnikel and Ziegler ("Fast Recursive Division", 1998), numbers
+// has 2 * count numbers, the divisor count numbers and is normalized, the quotient gets count
+// numbers and the highest quotient number (0 or 1) is returned, the remainder is stored in the
+// lower count numbers of numbers, scratch has to have bigint_div_recursive_scratch_count numbers
+NODISCARD static uint64_t
+bigint_helper_limbs_divrem_recursive(uint64_t* quotient, // NOLINT(misc-no-recursion)
+                                     uint64_t* numbers, const uint64_t* divisor, size_t count,
+                                     uint64_t* scratch) {
+
+	if(count < BIGINT_DIV_RECURSIVE_THRESHOLD) {
+		return bigint_helper_limbs_divrem_schoolbook(quotient, numbers, 2 * count, divisor,
+		                                             count);
+	}
+
+	// the quotient is computed in two halves, every half is estimated by dividing by the upper
+	// half of the divisor recursively, and then corrected with the product of the quotient half and
+	// the lower half of the divisor, as the divisor is normalized, this needs at most 2 corrections
+	// NOTE: the high half is msb and the low half lsb, as the numbers are stored in reverse order
+
+	const size_t low_count = count / 2;
+	const size_t high_count = count - low_count;
+
+	uint64_t* const product = scratch;
+	uint64_t* const mul_scratch = scratch + count;
+
+	uint64_t quotient_high = U64(0);
+
+	{ // 1. the upper half of the quotient
+
+		quotient_high = bigint_helper_limbs_divrem_recursive(
+		    quotient + low_count, numbers + (2 * low_count), divisor + low_count, high_count,
+		    scratch);
+
+		bigint_mul_limbs(product, quotient + low_count, high_count, divisor, low_count,
+		                 mul_scratch);
+
+		uint64_t borrow = bigint_limbs_sub_n(numbers + low_count, numbers + low_count, product, count);
+
+		if(quotient_high != 0) {
+			borrow = borrow + bigint_limbs_sub_n(numbers + count, numbers + count, divisor,
+			                                     low_count);
+		}
+
+		while(borrow != 0) {
+			quotient_high = quotient_high - bigint_limbs_sub_1(quotient + low_count,
+			                                                   quotient + low_count, high_count, 1);
+			borrow = borrow - bigint_limbs_add_n(numbers + low_count, numbers + low_count, divisor,
+			                                     count);
+		}
+	}
+
+	{ // 2. the lower half of the quotient
+
+		uint64_t quotient_low_high = bigint_helper_limbs_divrem_recursive(
+		    quotient, numbers + high_count, divisor + high_count, low_count, scratch);
+
+		bigint_mul_limbs(product, divisor, high_count, quotient, low_count, mul_scratch);
+
+		uint64_t borrow = bigint_limbs_sub_n(numbers, numbers, product, count);
+
+		if(quotient_low_high != 0) {
+			borrow =
+			    borrow + bigint_limbs_sub_n(numbers + low_count, numbers + low_count, divisor,
+			                                high_count);
+		}
+
+		while(borrow != 0) {
+			// the recursive call may have returned an extra top number, borrow from it
+			const uint64_t quotient_borrow = bigint_limbs_sub_1(quotient, quotient, low_count, 1);
+			ASSERT(quotient_low_high >= quotient_borrow,
+			       "the lower half of the quotient can't be negative");
+			quotient_low_high = quotient_low_high - quotient_borrow;
+
+			borrow = borrow - bigint_limbs_add_n(numbers, numbers, divisor, count);
+		}
+
+		ASSERT(quotient_low_high == 0, "the lower half of the quotient has only low_count numbers");
+		UNUSED(quotient_low_high);
+	}
+
+	return quotient_high;
+}
+
+// divides the normalized numbers (count + 1 numbers, the top divisor_count numbers are less than
+// the divisor) by the normalized divisor, like bigint_helper_limbs_divrem_knuth, for big divisors
+// the quotient is computed in blocks of divisor_count numbers with the recursive division
+static void bigint_helper_limbs_divrem(uint64_t* quotient, uint64_t* numbers, size_t count,
+                                       const uint64_t* divisor, size_t divisor_count) {
+
+	if(divisor_count < BIGINT_DIV_RECURSIVE_THRESHOLD) {
+		bigint_helper_limbs_divrem_knuth(quotient, numbers, count, divisor, divisor_count);
+		return;
+	}
+
+	const size_t quotient_count = count - divisor_count + 1;
+
+	// 1. the top block, that is not a full block, uses the schoolbook division
+	size_t offset = quotient_count - (quotient_count % divisor_count);
+
+	if(offset != quotient_count) {
+		bigint_helper_limbs_divrem_knuth(quotient + offset, numbers + offset,
+		                                 divisor_count + (quotient_count - offset) - 1, divisor,
+		                                 divisor_count);
+	}
+
+	// 2. the full blocks, the top half of every block is the remainder of the block before, so
+	// it's less than the divisor
+	uint64_t* scratch =
+	    bigint_helper_allocate_scratch(bigint_div_recursive_scratch_count(divisor_count));
+
+	while(offset != 0) {
+		offset = offset - divisor_count;
+
+		const uint64_t quotient_high = bigint_helper_limbs_divrem_recursive(
+		    quotient + offset, numbers + offset, divisor, divisor_count, scratch);
+
+		ASSERT(quotient_high == 0, "the quotient block has to fit into the block");
+		UNUSED(quotient_high);
+	}
+
+	free(scratch);
+}
+
+// below this amount of numbers of the divisor, the recursive division is faster than the division
+// with the newton reciprocal, as long as the multiplication is not faster than toom-3, the
+// recursive division stays faster at all measured sizes (up to 160000 numbers), so this is only
+// used for really huge divisors
+#ifndef BIGINT_DIV_NEWTON_THRESHOLD
+#define BIGINT_DIV_NEWTON_THRESHOLD 1000000
+#endif
+
+// the base case of the newton iteration uses the normal division, that must not use the newton
+// division itself
+#if BIGINT_DIV_NEWTON_THRESHOLD <= BIGINT_DIV_RECURSIVE_THRESHOLD
+#error "BIGINT_DIV_NEWTON_THRESHOLD has to be greater than BIGINT_DIV_RECURSIVE_THRESHOLD"
+#endif
+
+// up to this precision the reciprocal is computed directly with a division
+#define RECIPROCAL_NEWTON_BASE_BITS (NUMBER_BIT_COUNT * BIGINT_DIV_RECURSIVE_THRESHOLD)
+
+// extra bits, that every newton step computes, so that the error of the result doesn't grow from
+// step to step
+#define RECIPROCAL_NEWTON_GUARD_BITS 8
+
+NODISCARD static BigIntDivModC bigint_divmod_both_positive(BigIntC dividend, BigIntC divisor);
+
+// returns the highest precision bits of |big_int|, that has bit_length bits, if it has fewer bits,
+// zeroes are appended at the bottom
+NODISCARD static BigIntC bigint_helper_top_bits(BigIntC big_int, size_t bit_length,
+                                                size_t precision) {
+
+	if(precision <= bit_length) {
+		return bigint_helper_shift_right(big_int, bit_length - precision);
+	}
+
+	return bigint_helper_shift_left(big_int, precision - bit_length);
+}
+
+// returns about 2^(2 * precision) / top, where top are the highest precision bits of the divisor
+// (see bigint_helper_top_bits), the result is off by a few units at most, every newton step
+// doubles the precision, so the whole iteration costs about as much as two multiplications at
+// the full precision
+NODISCARD static BigIntC // NOLINTNEXTLINE(misc-no-recursion)
+bigint_helper_reciprocal_newton(BigIntC divisor, size_t divisor_bits, size_t precision) {
+
+	BigIntC top = bigint_helper_top_bits(divisor, divisor_bits, precision);
+
+	if(precision <= RECIPROCAL_NEWTON_BASE_BITS) {
+
+		BigIntC one = bigint_from_unsigned_number(1);
+		BigIntC power = bigint_helper_shift_left(one, 2 * precision);
+
+		BigIntDivModC result = bigint_divmod_both_positive(power, top);
+
+		free_bigint_without_reset(one);
+		free_bigint_without_reset(power);
+		free_bigint_without_reset(top);
+		free_bigint_without_reset(result.remainder);
+
+		return result.quotient;
+	}
+
+	// x is about 2^(2 * half) / top_half, then the newton step for the precision is
+	// y = x * 2^(precision - half) - x * e / 2^(2 * half) with e = top * x - 2^(precision + half)
+	const size_t half = (precision / 2) + RECIPROCAL_NEWTON_GUARD_BITS;
+
+	BigIntC approximation = bigint_helper_reciprocal_newton(divisor, divisor_bits, half);
+
+	BigIntC one = bigint_from_unsigned_number(1);
+	BigIntC power = bigint_helper_shift_left(one, precision + half);
+
+	BigIntC product = bigint_mul_bigint(top, approximation);
+	BigIntC error = bigint_sub_bigint(product, power);
+
+	const bool error_positive = error.positive;
+	error.positive = true;
+
+	// e has about precision bits, but its lower half - guard bits change the correction by less
+	// than one, so they are dropped before the multiplication
+	const size_t error_ignored_bits = half - RECIPROCAL_NEWTON_GUARD_BITS;
+
+	BigIntC error_high = bigint_helper_shift_right(error, error_ignored_bits);
+
+	BigIntC correction_full = bigint_mul_bigint(approximation, error_high);
+	BigIntC correction =
+	    bigint_helper_shift_right(correction_full, (2 * half) - error_ignored_bits);
+
+	BigIntC scaled = bigint_helper_shift_left(approximation, precision - half);
+
+	BigIntC result = error_positive ? bigint_sub_bigint(scaled, correction)
+	                                : bigint_add_bigint(scaled, correction);
+
+	free_bigint_without_reset(top);
+	free_bigint_without_reset(approximation);
+	free_bigint_without_reset(one);
+	free_bigint_without_reset(power);
+	free_bigint_without_reset(product);
+	free_bigint_without_reset(error);
+	free_bigint_without_reset(error_high);
+	free_bigint_without_reset(correction_full);
+	free_bigint_without_reset(correction);
+	free_bigint_without_reset(scaled);
+
+	return result;
+}
+
+// returns about 2^bits / divisor, the divisor has to be positive and have divisor_bits bits, the
+// result is off by at most one
+NODISCARD static BigIntC bigint_helper_reciprocal_approximation(BigIntC divisor,
+                                                                size_t divisor_bits, size_t bits) {
+
+	if(bits + 1 < divisor_bits) {
+		// 2^bits < divisor
+		return bigint_helper_zero();
+	}
+
+	// 2^bits / divisor = 2^(2 * precision) / top / 2^(guard + 1), with the top precision bits
+	const size_t precision = bits - divisor_bits + 1 + RECIPROCAL_NEWTON_GUARD_BITS;
+
+	BigIntC reciprocal = bigint_helper_reciprocal_newton(divisor, divisor_bits, precision);
+
+	BigIntC result = bigint_helper_shift_right(reciprocal, RECIPROCAL_NEWTON_GUARD_BITS + 1);
+
+	free_bigint_without_reset(reciprocal);
+
+	return result;
+}
+
+// divides the numerator by the divisor, that has divisor_bits bits, with the reciprocal about
+// 2^bits / divisor, the numerator has to be less than 2^bits, both have to be positive, the
+// quotient is estimated with one multiplication and then corrected with the remainder
+NODISCARD static BigIntDivModC bigint_helper_divmod_with_reciprocal(BigIntC numerator,
+                                                                    BigIntC divisor,
+                                                                    size_t divisor_bits,
+                                                                    BigIntC reciprocal,
+                                                                    size_t bits) {
+
+	// the lower bits of the numerator change the estimate by less than one, so they are ignored
+	const size_t ignored_bits = divisor_bits > RECIPROCAL_NEWTON_GUARD_BITS + 1
+	                                ? divisor_bits - RECIPROCAL_NEWTON_GUARD_BITS - 1
+	                                : 0;
+
+	BigIntC numerator_high = bigint_helper_shift_right(numerator, ignored_bits);
+	BigIntC estimate_full = bigint_mul_bigint(numerator_high, reciprocal);
+
+	BigIntDivModC result = { .quotient = bigint_helper_shift_right(estimate_full,
+		                                                           bits - ignored_bits),
+		                     .remainder = { .positive = true, .numbers = NULL, .number_count = 0 } };
+
+	BigIntC product = bigint_mul_bigint(result.quotient, divisor);
+	result.remainder = bigint_sub_bigint(numerator, product);
+
+	free_bigint_without_reset(numerator_high);
+	free_bigint_without_reset(estimate_full);
+	free_bigint_without_reset(product);
+
+	// the estimate is off by a few units at most
+	while(!result.remainder.positive) {
+		bigint_helper_replace(&(result.quotient), bigint_sub_u64(result.quotient, 1));
+		bigint_helper_replace(&(result.remainder), bigint_add_bigint(result.remainder, divisor));
+	}
+
+	while(bigint_compare_bigint(result.remainder, divisor) >= 0) {
+		bigint_helper_replace(&(result.quotient), bigint_add_u64(result.quotient, 1));
+		bigint_helper_replace(&(result.remainder), bigint_sub_bigint(result.remainder, divisor));
+	}
+
+	return result;
+}
+
+// the division with the newton reciprocal of the divisor, both have to be positive, the dividend
+// is processed in blocks of divisor.number_count numbers, so that one reciprocal of that precision
+// is enough for all of them
+NODISCARD static BigIntDivModC bigint_helper_divmod_newton(BigIntC dividend, BigIntC divisor) {
+
+	const size_t divisor_count = divisor.number_count;
+	const size_t divisor_bits = bigint_helper_bit_length(divisor);
+
+	// every block is less than divisor * 2^(64 * divisor_count)
+	const size_t bits = divisor_bits + (NUMBER_BIT_COUNT * divisor_count);
+
+	BigIntC reciprocal = bigint_helper_reciprocal_approximation(divisor, divisor_bits, bits);
+
+	BigIntDivModC result = { .quotient = bigint_helper_zero_of_size(dividend.number_count -
+		                                                            divisor_count + 1),
+		                     .remainder = { .positive = true, .numbers = NULL, .number_count = 0 } };
+
+	// 1. the top block has the top divisor_count numbers and the numbers, that don't make up a
+	// full block
+	size_t offset = (dividend.number_count - divisor_count) -
+	                ((dividend.number_count - divisor_count) % divisor_count);
+
+	{
+		const BigIntC block = bigint_helper_view_of_slice((BigIntSlice){
+		    .numbers = dividend.numbers + offset, .number_count = dividend.number_count - offset });
+
+		BigIntDivModC block_result = bigint_helper_divmod_with_reciprocal(
+		    block, divisor, divisor_bits, reciprocal, bits);
+
+		bigint_limbs_copy(result.quotient.numbers + offset, block_result.quotient.numbers,
+		                  block_result.quotient.number_count);
+
+		free_bigint_without_reset(block_result.quotient);
+		result.remainder = block_result.remainder;
+	}
+
+	// 2. the full blocks, the remainder of the block before is their top part
+	while(offset != 0) {
+		offset = offset - divisor_count;
+
+		BigIntC block = { .positive = true,
+			              .numbers = NULL,
+			              .number_count = divisor_count + result.remainder.number_count };
+
+		bigint_helper_realloc_to_new_size(&block);
+
+		bigint_limbs_copy(block.numbers, dividend.numbers + offset, divisor_count);
+		bigint_limbs_copy(block.numbers + divisor_count, result.remainder.numbers,
+		                  result.remainder.number_count);
+
+		bigint_helper_remove_leading_zeroes(&block);
+
+		BigIntDivModC block_result = bigint_helper_divmod_with_reciprocal(
+		    block, divisor, divisor_bits, reciprocal, bits);
+
+		ASSERT(block_result.quotient.number_count <= divisor_count,
+		       "the quotient block has to fit into the block");
+
+		bigint_limbs_copy(result.quotient.numbers + offset, block_result.quotient.numbers,
+		                  block_result.quotient.number_count);
+
+		free_bigint_without_reset(block);
+		free_bigint_without_reset(block_result.quotient);
+		bigint_helper_replace(&(result.remainder), block_result.remainder);
+	}
+
+	free_bigint_without_reset(reciprocal);
+
+	bigint_helper_remove_leading_zeroes(&(result.quotient));
+
+	return result;
+}
+
+NODISCARD static BigIntDivModC bigint_divmod_both_positive(BigIntC dividend, BigIntC divisor) {
+
+	BigIntDivModC result = { .quotient = { .positive = true, .numbers = NULL, .number_count = 0 },
+		                     .remainder = { .positive = true, .numbers = NULL, .number_count = 0 } };
+
+	if(bigint_compare_bigint(dividend, divisor) < 0) {
+		// a / b = 0 remainder a, if a < b
+		result.quotient = bigint_helper_zero();
+		result.remainder = bigint_helper_get_full_copy(dividend);
+		return result;
+	}
+
+	if(divisor.number_count >= BIGINT_DIV_NEWTON_THRESHOLD) {
+		return bigint_helper_divmod_newton(dividend, divisor);
+	}
+
+	result.quotient.number_count = dividend.number_count - divisor.number_count + 1;
+	bigint_helper_realloc_to_new_size(&(result.quotient));
+
+	if(divisor.number_count == 1) {
+
+		const uint64_t remainder =
+		    bigint_limbs_divrem_1_pre(result.quotient.numbers, dividend.numbers,
+		                              dividend.number_count,
+		                              bigint_divisor_u64_from_number(divisor.numbers[0]));
+
+		result.remainder = bigint_from_unsigned_number(remainder);
+
+	} else {
+
+		const size_t shift =
+		    helper_count_leading_zeros(divisor.numbers[divisor.number_count - 1]);
+
+		// the normalized dividend needs one more number on top, both are stored in one buffer
+		uint64_t* scratch =
+		    bigint_helper_allocate_scratch(dividend.number_count + 1 + divisor.number_count);
+
+		uint64_t* const numbers = scratch;
+		uint64_t* const normalized_divisor = scratch + dividend.number_count + 1;
+
+		numbers[dividend.number_count] =
+		    bigint_limbs_lshift(numbers, dividend.numbers, dividend.number_count,
+		                        (unsigned int)shift);
+
+		const uint64_t shifted_out = bigint_limbs_lshift(normalized_divisor, divisor.numbers,
+		                                                 divisor.number_count, (unsigned int)shift);
+		ASSERT(shifted_out == 0, "the shift has to be the amount of leading zeroes");
+		UNUSED(shifted_out);
+
+		bigint_helper_limbs_divrem(result.quotient.numbers, numbers, dividend.number_count,
+		                           normalized_divisor, divisor.number_count);
+
+		// the remainder is in the lower numbers, it still needs to be shifted back
+		result.remainder.number_count = divisor.number_count;
+		bigint_helper_realloc_to_new_size(&(result.remainder));
+
+		const uint64_t remainder_shifted_out = bigint_limbs_rshift(
+		    result.remainder.numbers, numbers, divisor.number_count, (unsigned int)shift);
+		ASSERT(remainder_shifted_out == 0, "the remainder has to be a multiple of 2^shift");
+		UNUSED(remainder_shifted_out);
+
+		free(scratch);
+
+		bigint_helper_remove_leading_zeroes(&(result.remainder));
+	}
+
+	bigint_helper_remove_leading_zeroes(&(result.quotient));
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntDivModC bigint_divmod(BigIntC dividend, BigIntC divisor) {
+
+	if(divisor.number_count == 1 && divisor.numbers[0] == 0) {
+		UNREACHABLE_WITH_MSG("division by zero");
+	}
+
+	const bool dividend_positive = dividend.positive;
+	const bool divisor_positive = divisor.positive;
+
+	dividend.positive = true;
+	divisor.positive = true;
+
+	BigIntDivModC result = bigint_divmod_both_positive(dividend, divisor);
+
+	// the quotient is truncated, so it is negative, if the signs are different and the remainder
+	// has the sign of the dividend, so that dividend = quotient * divisor + remainder
+	if(dividend_positive != divisor_positive) {
+		bigint_negate(&(result.quotient));
+	}
+
+	if(!dividend_positive) {
+		bigint_negate(&(result.remainder));
+	}
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntDivModC bigint_divmod_floor(BigIntC dividend,
+                                                                  BigIntC divisor) {
+
+	BigIntDivModC result = bigint_divmod(dividend, divisor);
+
+	const bool remainder_is_zero =
+	    result.remainder.number_count == 1 && result.remainder.numbers[0] == 0;
+
+	// the floored quotient is one less than the truncated one, if the exact quotient is negative
+	// and not an integer, the remainder then has the sign of the divisor
+	if(!remainder_is_zero && dividend.positive != divisor.positive) {
+
+		BigIntC quotient = bigint_sub_u64(result.quotient, 1);
+		free_bigint_without_reset(result.quotient);
+		result.quotient = quotient;
+
+		BigIntC remainder = bigint_add_bigint(result.remainder, divisor);
+		free_bigint_without_reset(result.remainder);
+		result.remainder = remainder;
+	}
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_div(BigIntC dividend, BigIntC divisor) {
+
+	BigIntDivModC result = bigint_divmod(dividend, divisor);
+
+	free_bigint_without_reset(result.remainder);
+
+	return result.quotient;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mod(BigIntC dividend, BigIntC divisor) {
+
+	BigIntDivModC result = bigint_divmod(dividend, divisor);
+
+	free_bigint_without_reset(result.quotient);
+
+	return result.remainder;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_div_floor(BigIntC dividend, BigIntC divisor) {
+
+	BigIntDivModC result = bigint_divmod_floor(dividend, divisor);
+
+	free_bigint_without_reset(result.remainder);
+
+	return result.quotient;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mod_floor(BigIntC dividend, BigIntC divisor) {
+
+	BigIntDivModC result = bigint_divmod_floor(dividend, divisor);
+
+	free_bigint_without_reset(result.quotient);
+
+	return result.remainder;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_reciprocal(BigIntC big_int, size_t bits) {
+
+	if(big_int.number_count == 1 && big_int.numbers[0] == 0) {
+		UNREACHABLE_WITH_MSG("division by zero");
+	}
+
+	const bool positive = big_int.positive;
+	big_int.positive = true;
+
+	BigIntC result =
+	    bigint_helper_reciprocal_approximation(big_int, bigint_helper_bit_length(big_int), bits);
+
+	{ // 1. the approximation is off by at most one, so correct it with the remainder
+
+		BigIntC one = bigint_from_unsigned_number(1);
+		BigIntC power = bigint_helper_shift_left(one, bits);
+		BigIntC product = bigint_mul_bigint(result, big_int);
+
+		BigIntC remainder = bigint_sub_bigint(power, product);
+
+		while(!remainder.positive) {
+			bigint_helper_replace(&result, bigint_sub_u64(result, 1));
+			bigint_helper_replace(&remainder, bigint_add_bigint(remainder, big_int));
+		}
+
+		while(bigint_compare_bigint(remainder, big_int) >= 0) {
+			bigint_helper_replace(&result, bigint_add_u64(result, 1));
+			bigint_helper_replace(&remainder, bigint_sub_bigint(remainder, big_int));
+		}
+
+		free_bigint_without_reset(one);
+		free_bigint_without_reset(power);
+		free_bigint_without_reset(product);
+		free_bigint_without_reset(remainder);
+	}
+
+	if(!positive) {
+		bigint_negate(&result);
+	}
+
+	return result;
+}
+
+// exact division, if the remainder is known to be 0, the quotient can be computed from the lowest
+// number on with the inverse of the divisor modulo 2^64, without estimating and correcting it, see
+// "An algorithm for exact division" by Jebelean, 1993
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_divexact_u64(BigIntC dividend, uint64_t divisor) {
+
+	if(divisor == 0) {
+		UNREACHABLE_WITH_MSG("division by zero");
+	}
+
+	BigIntC result = bigint_helper_get_full_copy(dividend);
+
+	// 1. the factors of two are shifted out, then the rest of the divisor is odd
+	const size_t shift = helper_count_trailing_zeros(divisor);
+
+	const uint64_t shifted_out =
+	    bigint_limbs_rshift(result.numbers, result.numbers, result.number_count,
+	                        (unsigned int)shift);
+	ASSERT(shifted_out == 0, "the division was not exact");
+	UNUSED(shifted_out);
+
+	// 2. the remaining odd divisor
+	const bool positive = result.positive;
+	result.positive = true;
+
+	bigint_helper_divexact_by_odd_number_in_place(&result, divisor >> shift);
+
+	if(!positive) {
+		bigint_negate(&result);
+	}
+
+	return result;
+}
+
+// if both the quotient and the divisor have at least this amount of numbers, the general
+// (recursive) division is faster than the exact division from the lowest number on, that needs
+// about quotient_count * min(quotient_count, divisor_count) steps
+#ifndef BIGINT_DIVEXACT_DIVISION_THRESHOLD
+#define BIGINT_DIVEXACT_DIVISION_THRESHOLD 800
+#endif
+
+// the exact division of two positive numbers from the lowest number on, the divisor has at least
+// 2 numbers and isn't greater than the dividend
+NODISCARD static BigIntC bigint_helper_divexact_from_low(BigIntC dividend, BigIntC divisor) {
+
+	// the numbers below the lowest non zero number of the divisor are zero in both
+	size_t zero_count = 0;
+	while(divisor.numbers[zero_count] == 0) {
+		++zero_count;
+	}
+
+	const size_t shift = helper_count_trailing_zeros(divisor.numbers[zero_count]);
+
+	size_t count = dividend.number_count - zero_count;
+	size_t divisor_count = divisor.number_count - zero_count;
+
+	// the shifted dividend and divisor are stored in one buffer
+	uint64_t* scratch = bigint_helper_allocate_scratch(count + divisor_count);
+
+	uint64_t* const numbers = scratch;
+	uint64_t* const odd_divisor = scratch + count;
+
+	{ // 1. shift out the common factors of two, the divisor is odd afterwards
+
+		const uint64_t shifted_out = bigint_limbs_rshift(
+		    numbers, dividend.numbers + zero_count, count, (unsigned int)shift);
+		ASSERT(shifted_out == 0, "the division was not exact");
+		UNUSED(shifted_out);
+
+		const uint64_t divisor_shifted_out = bigint_limbs_rshift(
+		    odd_divisor, divisor.numbers + zero_count, divisor_count, (unsigned int)shift);
+		UNUSED(divisor_shifted_out);
+
+		while(count > 1 && numbers[count - 1] == 0) {
+			--count;
+		}
+
+		while(divisor_count > 1 && odd_divisor[divisor_count - 1] == 0) {
+			--divisor_count;
+		}
+	}
+
+	if(count < divisor_count) {
+		ASSERT(count == 1 && numbers[0] == 0, "the division was not exact");
+		free(scratch);
+		return bigint_helper_zero();
+	}
+
+	BigIntC result = { .positive = true,
+		               .numbers = NULL,
+		               .number_count = count - divisor_count + 1 };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	{ // 2. every quotient number makes the lowest remaining number 0, only the numbers below the
+	  // quotient count are updated, the ones above have to cancel out, as the division is exact
+
+		const uint64_t inverse = bigint_helper_inverse_of_odd_number(odd_divisor[0]);
+
+		const size_t quotient_count = result.number_count;
+
+		for(size_t i = 0; i < quotient_count; ++i) {
+
+			const uint64_t quotient = numbers[i] * inverse;
+			result.numbers[i] = quotient;
+
+			const size_t remaining = quotient_count - i;
+			const size_t update_count = remaining < divisor_count ? remaining : divisor_count;
+
+			const uint64_t borrow =
+			    bigint_limbs_submul_1(numbers + i, odd_divisor, update_count, quotient);
+
+			const uint64_t final_borrow =
+			    bigint_limbs_sub_1(numbers + i + update_count, numbers + i + update_count,
+			                       remaining - update_count, borrow);
+			UNUSED(final_borrow);
+		}
+	}
+
+	free(scratch);
+
+	bigint_helper_remove_leading_zeroes(&result);
+
+	return result;
+}
+
+// the exact division of two positive numbers with the general division, the quotient only depends
+// on the top quotient_count + 2 numbers of the divisor, so the lower ones are cut off, that makes
+// the quotient at most one too small, which the lowest number of the quotient decides
+NODISCARD static BigIntC bigint_helper_divexact_from_high(BigIntC dividend, BigIntC divisor) {
+
+	const size_t quotient_count = dividend.number_count - divisor.number_count + 1;
+
+	const size_t cut_count = divisor.number_count > quotient_count + 2
+	                             ? divisor.number_count - quotient_count - 2
+	                             : 0;
+
+	const BigIntC dividend_high = bigint_helper_view_of_slice((BigIntSlice){
+	    .numbers = dividend.numbers + cut_count, .number_count = dividend.number_count - cut_count });
+	const BigIntC divisor_high = bigint_helper_view_of_slice((BigIntSlice){
+	    .numbers = divisor.numbers + cut_count, .number_count = divisor.number_count - cut_count });
+
+	BigIntDivModC result = bigint_divmod_both_positive(dividend_high, divisor_high);
+
+	free_bigint_without_reset(result.remainder);
+
+	if(cut_count != 0) {
+
+		// the lowest non zero number of quotient * divisor is quotient[0] * divisor[zero_count]
+		// (mod 2^64), for the quotient one less, it's different by divisor[zero_count]
+		size_t zero_count = 0;
+		while(divisor.numbers[zero_count] == 0) {
+			++zero_count;
+		}
+
+		if(result.quotient.numbers[0] * divisor.numbers[zero_count] !=
+		   dividend.numbers[zero_count]) {
+			bigint_helper_replace(&(result.quotient), bigint_add_u64(result.quotient, 1));
+		}
+	}
+
+	return result.quotient;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_divexact(BigIntC dividend, BigIntC divisor) {
+
+	if(divisor.number_count == 1) {
+
+		if(divisor.numbers[0] == 0) {
+			UNREACHABLE_WITH_MSG("division by zero");
+		}
+
+		BigIntC result = bigint_divexact_u64(dividend, divisor.numbers[0]);
+
+		if(!divisor.positive) {
+			bigint_negate(&result);
+		}
+
+		return result;
+	}
+
+	if(dividend.number_count < divisor.number_count) {
+		ASSERT(dividend.number_count == 1 && dividend.numbers[0] == 0,
+		       "the division was not exact");
+		return bigint_helper_zero();
+	}
+
+	BigIntC absolute_dividend = dividend;
+	absolute_dividend.positive = true;
+
+	BigIntC absolute_divisor = divisor;
+	absolute_divisor.positive = true;
+
+	const size_t quotient_count = dividend.number_count - divisor.number_count + 1;
+
+	BigIntC result = quotient_count < BIGINT_DIVEXACT_DIVISION_THRESHOLD ||
+	                         divisor.number_count < BIGINT_DIVEXACT_DIVISION_THRESHOLD
+	                     ? bigint_helper_divexact_from_low(absolute_dividend, absolute_divisor)
+	                     : bigint_helper_divexact_from_high(absolute_dividend, absolute_divisor);
+
+#ifndef NDEBUG
+	{ // check, that the division was exact, this needs a full multiplication
+		BigIntC product = bigint_mul_bigint(result, absolute_divisor);
+		ASSERT(bigint_eq_bigint(product, absolute_dividend), "the division was not exact");
+		free_bigint_without_reset(product);
+	}
+#endif
+
+	if(dividend.positive != divisor.positive) {
+		bigint_negate(&result);
+	}
+
+	return result;
+}
+
+// exponentiation
+
+// the window size in bits of the sliding window exponentiation for exponents with this many bits,
+// the table has 2^(window_bits - 1) odd powers of the base, so a larger window only pays off for
+// larger exponents
+#define POW_MAX_WINDOW_BITS 4
+
+NODISCARD static size_t helper_pow_window_bits(size_t exponent_bits) {
+
+	if(exponent_bits <= 6) {
+		return 1;
+	}
+
+	if(exponent_bits <= 24) {
+		return 2;
+	}
+
+	if(exponent_bits <= 48) {
+		return 3;
+	}
+
+	return POW_MAX_WINDOW_BITS;
+}
+
+// the scratch buffer of the exponentiation only grows, so that it is only reallocated a few times
+static void bigint_helper_reserve_scratch(uint64_t** scratch, size_t* capacity, size_t count) {
+
+	if(count <= *capacity) {
+		return;
+	}
+
+	free(*scratch);
+
+	*scratch = bigint_helper_allocate_scratch(count);
+	*capacity = count;
+}
+
+// returns the count of numbers without leading zeroes, but at least 1
+NODISCARD static size_t helper_normalized_count(const uint64_t* numbers, size_t count) {
+
+	while(count > 1 && numbers[count - 1] == 0) {
+		--count;
+	}
+
+	return count;
+}
+
+// target = numbers^2, target has to have space for 2 * count numbers, returns the count of the
+// square without leading zeroes
+NODISCARD static size_t bigint_helper_pow_sqr(uint64_t* target, const uint64_t* numbers,
+                                              size_t count, uint64_t** scratch,
+                                              size_t* scratch_capacity) {
+
+	if(count >= BIGINT_SQR_TOOM3_THRESHOLD) {
+		// toom-3 allocates its own temporaries, but at this size that doesn't matter
+		BigIntC square =
+		    bigint_sqr_impl((BigIntSlice){ .numbers = numbers, .number_count = count });
+
+		bigint_limbs_copy(target, square.numbers, square.number_count);
+
+		const size_t square_count = square.number_count;
+
+		free_bigint_without_reset(square);
+
+		return square_count;
+	}
+
+	bigint_helper_reserve_scratch(scratch, scratch_capacity,
+	                              bigint_sqr_limbs_scratch_count(count));
+
+	bigint_sqr_limbs(target, numbers, count, *scratch);
+
+	return helper_normalized_count(target, 2 * count);
+}
+
+// target = numbers * factor, target has to have space for count + factor.number_count numbers,
+// returns the count of the product without leading zeroes
+NODISCARD static size_t bigint_helper_pow_mul(uint64_t* target, const uint64_t* numbers,
+                                              size_t count, BigIntC factor, uint64_t** scratch,
+                                              size_t* scratch_capacity) {
+
+	const uint64_t* numbers1 = numbers;
+	size_t count1 = count;
+	const uint64_t* numbers2 = factor.numbers;
+	size_t count2 = factor.number_count;
+
+	// the first number is the longer one
+	if(count1 < count2) {
+		numbers1 = factor.numbers;
+		count1 = factor.number_count;
+		numbers2 = numbers;
+		count2 = count;
+	}
+
+	bigint_helper_reserve_scratch(scratch, scratch_capacity,
+	                              bigint_mul_limbs_scratch_count(count1, count2));
+
+	bigint_mul_limbs(target, numbers1, count1, numbers2, count2, *scratch);
+
+	return helper_normalized_count(target, count1 + count2);
+}
+
+// returns odd^exponent with a left to right sliding window exponentiation, odd has to be odd,
+// greater than 1 and positive, exponent can't be 0
+NODISCARD static BigIntC bigint_helper_pow_odd(BigIntC odd, uint64_t exponent) {
+
+	const size_t odd_bits = bigint_helper_bit_length(odd);
+
+	if(exponent > SIZE_MAX / odd_bits) { // GCOVR_EXCL_BR_LINE (result too big)
+		UNREACHABLE_WITH_MSG(            // GCOVR_EXCL_LINE (result too big)
+		    "the result of the exponentiation is too big");
+	} // GCOVR_EXCL_LINE (result too big)
+
+	// odd < 2^odd_bits, so odd^exponent < 2^(odd_bits * exponent), every intermediate result is a
+	// power of odd with a smaller exponent, so a square or product of two normalized values with
+	// that bound has at most one number more than the bound, before it is normalized
+	const size_t buffer_count = helper_ceil_div(odd_bits * (size_t)exponent, NUMBER_BIT_COUNT) + 1;
+
+	uint64_t* current = bigint_helper_allocate_scratch(buffer_count);
+	uint64_t* other = bigint_helper_allocate_scratch(buffer_count);
+	size_t current_count = 0;
+
+	uint64_t* scratch = NULL;
+	size_t scratch_capacity = 0;
+
+	const size_t exponent_bits = bigint_helper_bits_of_number_used(exponent);
+	const size_t window_bits = helper_pow_window_bits(exponent_bits);
+	const size_t table_count = (size_t)1 << (window_bits - 1);
+
+	// table[i] = odd^(2 * i + 1)
+	BigIntC table[(size_t)1 << (POW_MAX_WINDOW_BITS - 1)];
+
+	{ // 1. precompute the odd powers
+
+		table[0] = bigint_copy(odd);
+
+		if(table_count > 1) {
+			BigIntC square = bigint_sqr(odd);
+
+			for(size_t i = 1; i < table_count; ++i) {
+				table[i] = bigint_mul_bigint(table[i - 1], square);
+			}
+
+			free_bigint_without_reset(square);
+		}
+	}
+
+	// 2. go through the exponent from the top bit on, a run of zeroes is just squared, otherwise
+	// the longest window of at most window_bits bits, that ends with a one, is taken, the result
+	// is squared once per bit of it and multiplied with the odd power of the window value
+	size_t remaining_bits = exponent_bits;
+
+	while(remaining_bits != 0) {
+
+		const size_t top_index = remaining_bits - 1;
+
+		if(((exponent >> top_index) & 0x01) == 0) {
+			current_count = bigint_helper_pow_sqr(other, current, current_count, &scratch,
+			                                      &scratch_capacity);
+
+			uint64_t* const temp = current;
+			current = other;
+			other = temp;
+
+			remaining_bits = top_index;
+			continue;
+		}
+
+		size_t bottom_index = remaining_bits > window_bits ? remaining_bits - window_bits : 0;
+
+		while(((exponent >> bottom_index) & 0x01) == 0) {
+			++bottom_index;
+		}
+
+		const size_t window_size = top_index - bottom_index + 1;
+		const uint64_t window_value =
+		    (exponent >> bottom_index) & ((U64(1) << window_size) - U64(1));
+
+		const BigIntC factor = table[(window_value - 1) / 2];
+
+		if(current_count == 0) {
+			// the top window, there is nothing to square yet
+			bigint_limbs_copy(current, factor.numbers, factor.number_count);
+			current_count = factor.number_count;
+		} else {
+			for(size_t i = 0; i < window_size; ++i) {
+				current_count = bigint_helper_pow_sqr(other, current, current_count, &scratch,
+				                                      &scratch_capacity);
+
+				uint64_t* const temp = current;
+				current = other;
+				other = temp;
+			}
+
+			current_count = bigint_helper_pow_mul(other, current, current_count, factor,
+			                                      &scratch, &scratch_capacity);
+
+			uint64_t* const temp = current;
+			current = other;
+			other = temp;
+		}
+
+		remaining_bits = bottom_index;
+	}
+
+	for(size_t i = 0; i < table_count; ++i) {
+		free_bigint_without_reset(table[i]);
+	}
+
+	free(scratch);
+	free(other);
+
+	BigIntC result = { .positive = true, .numbers = current, .number_count = current_count };
+
+	// the buffer was allocated for the upper bound, so give the rest back
+	bigint_helper_realloc_to_new_size(&result);
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_pow_u64(BigIntC base, uint64_t exponent) {
+
+	if(exponent == 0) {
+		// this includes 0^0 = 1
+		return bigint_from_unsigned_number(1);
+	}
+
+	if(base.number_count == 1 && base.numbers[0] == 0) {
+		return bigint_helper_zero();
+	}
+
+	// (-a)^e = a^e, if e is even and -(a^e) otherwise
+	const bool positive = base.positive || (exponent & 0x01) == 0;
+
+	base.positive = true;
+
+	// a = odd * 2^shift, so a^e = odd^e * 2^(shift * e), the power of two is just a shift at the
+	// end, that also makes powers of two a single shift
+	const size_t shift = bigint_ctz(base);
+
+	if(shift != 0 && exponent > SIZE_MAX / shift) { // GCOVR_EXCL_BR_LINE (result too big)
+		UNREACHABLE_WITH_MSG(                        // GCOVR_EXCL_LINE (result too big)
+		    "the result of the exponentiation is too big");
+	} // GCOVR_EXCL_LINE (result too big)
+
+	BigIntC result;
+
+	if(bigint_helper_bit_length(base) == shift + 1) {
+		result = bigint_from_unsigned_number(1);
+	} else if(shift == 0) {
+		result = bigint_helper_pow_odd(base, exponent);
+	} else {
+		BigIntC odd = bigint_helper_shift_right(base, shift);
+
+		result = bigint_helper_pow_odd(odd, exponent);
+
+		free_bigint_without_reset(odd);
+	}
+
+	bigint_shl_in_place(&result, shift * (size_t)exponent);
+
+	if(!positive) {
+		bigint_negate(&result);
+	}
+
+	return result;
+}
+
+// modular exponentiation
+
+// montgomery arithmetic works with the representation a * R mod m, with R = 2^(64 * n) for a
+// modulus with n numbers, the product of two such values only needs a reduction by R, which is
+// just cutting off the lower numbers, after adding the right multiple of the modulus, see
+// "Modular multiplication without trial division" by Montgomery, 1985
+
+// the largest window of the fixed window exponentiation, the table has 2^window_bits entries
+#define POWM_MAX_WINDOW_BITS 6
+
+NODISCARD static size_t helper_powm_window_bits(size_t exponent_bits) {
+
+	if(exponent_bits <= 8) {
+		return 1;
+	}
+
+	if(exponent_bits <= 32) {
+		return 3;
+	}
+
+	if(exponent_bits <= 128) {
+		return 4;
+	}
+
+	if(exponent_bits <= 512) {
+		return 5;
+	}
+
+	return POWM_MAX_WINDOW_BITS;
+}
+
+// the numbers of the scratch memory of a context for a modulus with this many numbers: the table,
+// the current value, the double sized product and the scratch of the multiplication kernels
+NODISCARD static size_t bigint_helper_mont_scratch_count(size_t count) {
+
+	const size_t mul_scratch_count = bigint_mul_limbs_scratch_count(count, count);
+	const size_t sqr_scratch_count = bigint_sqr_limbs_scratch_count(count);
+
+	return (((size_t)1 << POWM_MAX_WINDOW_BITS) * count) + count + (2 * count) +
+	       (mul_scratch_count > sqr_scratch_count ? mul_scratch_count : sqr_scratch_count);
+}
+
+// result[0..n) = numbers[0..2n) * R^-1 mod m, numbers has to be less than m * R and is
+// overwritten, result can't overlap with numbers, every step adds a multiple of the modulus, so
+// that the lowest number becomes 0, the carry of it belongs n numbers higher, but as no later step
+// reads that number, it is stored in the now unused lowest number and added at the end
+static void bigint_helper_mont_reduce(uint64_t* result, uint64_t* numbers, const BigIntMontCtx* ctx) {
+
+	const size_t count = ctx->modulus.number_count;
+	const uint64_t* const modulus = ctx->modulus.numbers;
+
+	for(size_t i = 0; i < count; ++i) {
+		const uint64_t factor = numbers[i] * ctx->inverse;
+
+		numbers[i] = bigint_limbs_addmul_1(numbers + i, modulus, count, factor);
+	}
+
+	const uint64_t carry = bigint_limbs_add_n(result, numbers + count, numbers, count);
+
+	// the sum is less than 2 * m, so one subtraction is enough
+	if(carry != 0 || bigint_limbs_cmp(result, modulus, count) >= 0) {
+		const uint64_t borrow = bigint_limbs_sub_n(result, result, modulus, count);
+		UNUSED(borrow);
+		ASSERT(borrow == carry, "the result has to be less than the modulus");
+	}
+}
+
+// result[0..n) = numbers1 * numbers2 * R^-1 mod m, both have n numbers and are less than m,
+// result can be the same as one of them
+static void bigint_helper_mont_mul(uint64_t* result, const uint64_t* numbers1,
+                                   const uint64_t* numbers2, const BigIntMontCtx* ctx,
+                                   uint64_t* product, uint64_t* scratch) {
+
+	const size_t count = ctx->modulus.number_count;
+
+	if(numbers1 == numbers2) {
+		bigint_sqr_limbs(product, numbers1, count, scratch);
+	} else {
+		bigint_mul_limbs(product, numbers1, count, numbers2, count, scratch);
+	}
+
+	bigint_helper_mont_reduce(result, product, ctx);
+}
+
+// returns bit_count bits of numbers from index on, bits above the numbers are 0
+NODISCARD static uint64_t helper_get_bits(const uint64_t* numbers, size_t count, size_t index,
+                                          size_t bit_count) {
+
+	ASSERT(bit_count < NUMBER_BIT_COUNT, "too many bits");
+
+	const size_t number_index = index / NUMBER_BIT_COUNT;
+	const size_t offset = index % NUMBER_BIT_COUNT;
+
+	uint64_t value = numbers[number_index] >> offset;
+
+	if(offset + bit_count > NUMBER_BIT_COUNT && number_index + 1 < count) {
+		value |= numbers[number_index + 1] << (NUMBER_BIT_COUNT - offset);
+	}
+
+	return value & ((U64(1) << bit_count) - U64(1));
+}
+
+typedef struct {
+	uint64_t* table;
+	uint64_t* current;
+	uint64_t* product;
+	uint64_t* kernel_scratch;
+} MontScratch;
+
+// the parts of the scratch memory of the context, see bigint_helper_mont_scratch_count
+NODISCARD static MontScratch bigint_helper_mont_scratch(const BigIntMontCtx* ctx) {
+
+	const size_t count = ctx->modulus.number_count;
+
+	MontScratch scratch = {
+		.table = ctx->scratch, .current = NULL, .product = NULL, .kernel_scratch = NULL
+	};
+
+	scratch.current = scratch.table + (((size_t)1 << POWM_MAX_WINDOW_BITS) * count);
+	scratch.product = scratch.current + count;
+	scratch.kernel_scratch = scratch.product + (2 * count);
+
+	return scratch;
+}
+
+// result[0..n) = R mod m, the montgomery form of 1
+static void bigint_helper_mont_one(uint64_t* result, const BigIntMontCtx* ctx, uint64_t* product) {
+
+	const size_t count = ctx->modulus.number_count;
+
+	memset(product, 0, sizeof(uint64_t) * 2 * count);
+	bigint_limbs_copy(product, ctx->r_squared, count);
+	bigint_helper_mont_reduce(result, product, ctx);
+}
+
+// result[0..n) = big_int * R mod m, big_int is reduced first, which allocates, result can't be
+// the current value of the scratch memory
+static void bigint_helper_mont_from_bigint(uint64_t* result, BigIntC big_int,
+                                           const BigIntMontCtx* ctx, MontScratch scratch) {
+
+	const size_t count = ctx->modulus.number_count;
+
+	BigIntC reduced = bigint_mod_floor(big_int, ctx->modulus);
+
+	memset(scratch.current, 0, sizeof(uint64_t) * count);
+	bigint_limbs_copy(scratch.current, reduced.numbers, reduced.number_count);
+
+	free_bigint_without_reset(reduced);
+
+	bigint_helper_mont_mul(result, scratch.current, ctx->r_squared, ctx, scratch.product,
+	                       scratch.kernel_scratch);
+}
+
+// returns numbers * R^-1 mod m, that is one reduction of numbers * 1
+NODISCARD static BigIntC bigint_helper_mont_to_bigint(const uint64_t* numbers,
+                                                      const BigIntMontCtx* ctx, uint64_t* product) {
+
+	const size_t count = ctx->modulus.number_count;
+
+	BigIntC result = { .positive = true, .numbers = NULL, .number_count = count };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	memset(product + count, 0, sizeof(uint64_t) * count);
+	bigint_limbs_copy(product, numbers, count);
+	bigint_helper_mont_reduce(result.numbers, product, ctx);
+
+	bigint_helper_remove_leading_zeroes(&result);
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntMontCtx bigint_mont_ctx_from_modulus(BigIntC modulus) {
+
+	if(!modulus.positive || (modulus.numbers[0] & 0x01) == 0) {
+		UNREACHABLE_WITH_MSG("the modulus of a montgomery context has to be odd and positive");
+	}
+
+	const size_t count = modulus.number_count;
+
+	BigIntMontCtx ctx = { .modulus = bigint_copy(modulus),
+		                  .inverse = U64(0) - bigint_helper_inverse_of_odd_number(modulus.numbers[0]),
+		                  .r_squared = bigint_helper_allocate_scratch(count),
+		                  .scratch = bigint_helper_allocate_scratch(
+		                      bigint_helper_mont_scratch_count(count)) };
+
+	{ // R^2 mod m, this is only done once per modulus, so a normal division is fine
+		BigIntC one = bigint_from_unsigned_number(1);
+
+		BigIntC r_squared_power = bigint_shl(one, 2 * NUMBER_BIT_COUNT * count);
+		BigIntC r_squared = bigint_mod(r_squared_power, modulus);
+
+		memset(ctx.r_squared, 0, sizeof(uint64_t) * count);
+		bigint_limbs_copy(ctx.r_squared, r_squared.numbers, r_squared.number_count);
+
+		free_bigint_without_reset(one);
+		free_bigint_without_reset(r_squared_power);
+		free_bigint_without_reset(r_squared);
+	}
+
+	return ctx;
+}
+
+BIGINT_C_LIB_EXPORTED void free_bigint_mont_ctx(BigIntMontCtx* ctx) {
+
+	if(ctx == NULL) {
+		return;
+	}
+
+	free_bigint(&(ctx->modulus));
+
+	free(ctx->r_squared);
+	ctx->r_squared = NULL;
+
+	free(ctx->scratch);
+	ctx->scratch = NULL;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_powm_mont(BigIntC base, BigIntC exponent,
+                                                        BigIntMontCtx* ctx) {
+
+	if(!exponent.positive) {
+		UNREACHABLE_WITH_MSG("negative exponents are not supported");
+	}
+
+	const size_t count = ctx->modulus.number_count;
+
+	const size_t exponent_bits = bigint_helper_bit_length(exponent);
+
+	if(exponent_bits == 0) {
+		// x^0 = 1, that is 0 modulo 1
+		BigIntC one = bigint_from_unsigned_number(1);
+		BigIntC result = bigint_mod(one, ctx->modulus);
+		free_bigint_without_reset(one);
+		return result;
+	}
+
+	const size_t window_bits = helper_powm_window_bits(exponent_bits);
+	const size_t table_count = (size_t)1 << window_bits;
+
+	const MontScratch scratch = bigint_helper_mont_scratch(ctx);
+
+	uint64_t* const table = scratch.table;
+	uint64_t* const current = scratch.current;
+	uint64_t* const product = scratch.product;
+	uint64_t* const kernel_scratch = scratch.kernel_scratch;
+
+	{ // 1. the table of base^i * R mod m for all i with window_bits bits
+
+		bigint_helper_mont_one(table, ctx, product);
+
+		// the reduction of the base is the only allocation
+		bigint_helper_mont_from_bigint(table + count, base, ctx, scratch);
+
+		for(size_t i = 2; i < table_count; ++i) {
+			bigint_helper_mont_mul(table + (i * count), table + ((i - 1) * count), table + count,
+			                       ctx, product, kernel_scratch);
+		}
+	}
+
+	{ // 2. the windows from the top on, the top one can be shorter, so that all other ones are
+	  // aligned to the bottom
+
+		size_t position = exponent_bits - (exponent_bits % window_bits == 0
+		                                       ? window_bits
+		                                       : exponent_bits % window_bits);
+
+		const uint64_t top_window = helper_get_bits(exponent.numbers, exponent.number_count,
+		                                            position, exponent_bits - position);
+
+		bigint_limbs_copy(current, table + (top_window * count), count);
+
+		while(position != 0) {
+			position -= window_bits;
+
+			for(size_t i = 0; i < window_bits; ++i) {
+				bigint_helper_mont_mul(current, current, current, ctx, product, kernel_scratch);
+			}
+
+			const uint64_t window =
+			    helper_get_bits(exponent.numbers, exponent.number_count, position, window_bits);
+
+			if(window != 0) {
+				bigint_helper_mont_mul(current, current, table + (window * count), ctx, product,
+				                       kernel_scratch);
+			}
+		}
+	}
+
+	// 3. convert back from the montgomery form
+	return bigint_helper_mont_to_bigint(current, ctx, product);
+}
+
+// special form reduction, for moduli m = 2^k - c with a small c, x = h * 2^k + l is congruent to
+// h * c + l, so a reduction is only a shift and a multiplication with one number, this covers
+// mersenne numbers (c = 1), pseudo mersenne numbers like 2^255 - 19 and powers of two (c = 0)
+
+// the numbers of the scratch memory of a context for a modulus with this many numbers: the table
+// of the exponentiation, the current value, the window with 2 spare numbers for the carries of the
+// folding, the high part and the scratch of the multiplication kernels
+NODISCARD static size_t bigint_helper_special_scratch_count(size_t count) {
+
+	const size_t mul_scratch_count = bigint_mul_limbs_scratch_count(count, count);
+	const size_t sqr_scratch_count = bigint_sqr_limbs_scratch_count(count);
+
+	return (((size_t)1 << POWM_MAX_WINDOW_BITS) * count) + count + ((2 * count) + 2) +
+	       ((2 * count) + 1) +
+	       (mul_scratch_count > sqr_scratch_count ? mul_scratch_count : sqr_scratch_count);
+}
+
+typedef struct {
+	uint64_t* table;
+	uint64_t* current;
+	uint64_t* window;
+	uint64_t* high;
+	uint64_t* kernel_scratch;
+} SpecialScratch;
+
+NODISCARD static SpecialScratch bigint_helper_special_scratch(const BigIntSpecialCtx* ctx) {
+
+	const size_t count = ctx->modulus.number_count;
+
+	SpecialScratch scratch = { .table = ctx->scratch,
+		                       .current = NULL,
+		                       .window = NULL,
+		                       .high = NULL,
+		                       .kernel_scratch = NULL };
+
+	scratch.current = scratch.table + (((size_t)1 << POWM_MAX_WINDOW_BITS) * count);
+	scratch.window = scratch.current + count;
+	scratch.high = scratch.window + ((2 * count) + 2);
+	scratch.kernel_scratch = scratch.high + ((2 * count) + 1);
+
+	return scratch;
+}
+
+// if |modulus| = 2^bits - offset with an offset of at most bits / 2 bits, sets both and returns
+// true, so that every folding step removes at least half of the bits above 2^bits
+NODISCARD static bool bigint_helper_special_form(BigIntC modulus, size_t* bits,
+                                                 uint64_t* offset) {
+
+	modulus.positive = true;
+
+	if(modulus.number_count == 1 && modulus.numbers[0] <= 1) {
+		return false;
+	}
+
+	// 2^(k - 1) < m <= 2^k, that is k = bit_length(m - 1)
+	BigIntC predecessor = bigint_sub_u64(modulus, 1);
+	const size_t modulus_bits = bigint_helper_bit_length(predecessor);
+	free_bigint_without_reset(predecessor);
+
+	BigIntC one = bigint_from_unsigned_number(1);
+	BigIntC power = bigint_shl(one, modulus_bits);
+	BigIntC difference = bigint_sub_bigint(power, modulus);
+
+	const bool special =
+	    difference.number_count == 1 &&
+	    bigint_helper_bits_of_number_used(difference.numbers[0]) <= modulus_bits / 2;
+
+	*bits = modulus_bits;
+	*offset = difference.numbers[0];
+
+	free_bigint_without_reset(one);
+	free_bigint_without_reset(power);
+	free_bigint_without_reset(difference);
+
+	return special;
+}
+
+// numbers[0..count) = numbers mod m, the numbers are folded, until they are less than 2^k, numbers
+// needs space for count + 2 numbers and high for count + 1, returns the count without leading
+// zeroes
+NODISCARD static size_t bigint_helper_special_fold(uint64_t* numbers, size_t count,
+                                                   const BigIntSpecialCtx* ctx, uint64_t* high) {
+
+	const size_t word = ctx->bits / NUMBER_BIT_COUNT;
+	const unsigned int shift = (unsigned int)(ctx->bits % NUMBER_BIT_COUNT);
+
+	count = helper_normalized_count(numbers, count);
+
+	// as long as there are bits from k on
+	while(count > word + 1 || (count == word + 1 && (numbers[word] >> shift) != 0)) {
+
+		// 1. h = x >> k, l = x mod 2^k
+		size_t high_count = count - word;
+
+		const uint64_t shifted_out =
+		    bigint_limbs_rshift(high, numbers + word, high_count, shift);
+		UNUSED(shifted_out);
+
+		high_count = helper_normalized_count(high, high_count);
+
+		size_t low_count = word;
+
+		if(shift != 0) {
+			numbers[word] &= (U64(1) << shift) - U64(1);
+			low_count = word + 1;
+		}
+
+		// 2. x = h * c + l, this is less than x, as c < 2^k
+		high[high_count] = bigint_limbs_mul_1(high, high, high_count, ctx->offset);
+		++high_count;
+
+		if(high_count > low_count) {
+			uint64_t carry = bigint_limbs_add_n(numbers, numbers, high, low_count);
+
+			carry = bigint_limbs_add_1(numbers + low_count, high + low_count,
+			                           high_count - low_count, carry);
+
+			numbers[high_count] = carry;
+			count = high_count + 1;
+		} else {
+			uint64_t carry = bigint_limbs_add_n(numbers, numbers, high, high_count);
+
+			carry = bigint_limbs_add_1(numbers + high_count, numbers + high_count,
+			                           low_count - high_count, carry);
+
+			numbers[low_count] = carry;
+			count = low_count + 1;
+		}
+
+		count = helper_normalized_count(numbers, count);
+	}
+
+	// 3. x < 2^k = m + c, so x - m < c <= m and one subtraction is enough
+	const BigIntC modulus = ctx->modulus;
+
+	if(count > modulus.number_count ||
+	   (count == modulus.number_count &&
+	    bigint_limbs_cmp(numbers, modulus.numbers, modulus.number_count) >= 0)) {
+		const uint64_t borrow =
+		    bigint_limbs_sub_n(numbers, numbers, modulus.numbers, modulus.number_count);
+		UNUSED(borrow);
+
+		count = helper_normalized_count(numbers, modulus.number_count);
+	}
+
+	return count;
+}
+
+// result[0..n) = numbers[0..count) mod m, with count <= 2n, result can be the same as numbers or
+// point into it, as it is only written at the end
+static void bigint_helper_special_reduce(uint64_t* result, const uint64_t* numbers, size_t count,
+                                         const BigIntSpecialCtx* ctx) {
+
+	const size_t modulus_count = ctx->modulus.number_count;
+
+	ASSERT(count <= 2 * modulus_count, "the numbers have to be less than B^(2n)");
+
+	const SpecialScratch scratch = bigint_helper_special_scratch(ctx);
+
+	bigint_limbs_copy(scratch.window, numbers, count);
+
+	const size_t reduced_count =
+	    bigint_helper_special_fold(scratch.window, count, ctx, scratch.high);
+
+	memset(scratch.window + reduced_count, 0, sizeof(uint64_t) * (modulus_count - reduced_count));
+	bigint_limbs_copy(result, scratch.window, modulus_count);
+}
+
+// result[0..n) = numbers1 * numbers2 mod m, both have n numbers and are less than m, result can be
+// the same as one of them
+static void bigint_helper_special_mul(uint64_t* result, const uint64_t* numbers1,
+                                      const uint64_t* numbers2, const BigIntSpecialCtx* ctx) {
+
+	const size_t count = ctx->modulus.number_count;
+	const SpecialScratch scratch = bigint_helper_special_scratch(ctx);
+
+	if(numbers1 == numbers2) {
+		bigint_sqr_limbs(scratch.window, numbers1, count, scratch.kernel_scratch);
+	} else {
+		bigint_mul_limbs(scratch.window, numbers1, count, numbers2, count, scratch.kernel_scratch);
+	}
+
+	bigint_helper_special_reduce(result, scratch.window, 2 * count, ctx);
+}
+
+// numbers[0..n) = m - numbers, if numbers isn't 0, so that the remainder of the absolute value
+// becomes the remainder of a negative number
+static void bigint_helper_special_negate(uint64_t* numbers, const BigIntSpecialCtx* ctx) {
+
+	const size_t count = ctx->modulus.number_count;
+
+	if(helper_normalized_count(numbers, count) == 1 && numbers[0] == 0) {
+		return;
+	}
+
+	const uint64_t borrow = bigint_limbs_sub_n(numbers, ctx->modulus.numbers, numbers, count);
+	UNUSED(borrow);
+}
+
+// result[0..n) = big_int mod m in [0, m), in blocks of n numbers from the top on, like
+// bigint_mod_barrett, result can't be the window or the high part of the scratch memory
+static void bigint_helper_special_mod(uint64_t* result, BigIntC big_int,
+                                      const BigIntSpecialCtx* ctx) {
+
+	const size_t modulus_count = ctx->modulus.number_count;
+
+	size_t block_count = 0;
+
+	if(big_int.number_count > 2 * modulus_count) {
+		block_count = helper_ceil_div(big_int.number_count - (2 * modulus_count), modulus_count);
+	}
+
+	const size_t top_offset = block_count * modulus_count;
+
+	bigint_helper_special_reduce(result, big_int.numbers + top_offset,
+	                             big_int.number_count - top_offset, ctx);
+
+	const SpecialScratch scratch = bigint_helper_special_scratch(ctx);
+
+	for(size_t i = block_count; i != 0; --i) {
+		// the window r * B^n + block is less than m * B^n < B^(2n)
+		bigint_limbs_copy(scratch.window + modulus_count, result, modulus_count);
+		bigint_limbs_copy(scratch.window, big_int.numbers + ((i - 1) * modulus_count),
+		                  modulus_count);
+
+		bigint_helper_special_reduce(result, scratch.window, 2 * modulus_count, ctx);
+	}
+
+	if(!big_int.positive) {
+		bigint_helper_special_negate(result, ctx);
+	}
+}
+
+NODISCARD static BigIntC bigint_helper_special_result(const uint64_t* numbers,
+                                                      const BigIntSpecialCtx* ctx) {
+
+	BigIntC result = { .positive = true,
+		               .numbers = NULL,
+		               .number_count = ctx->modulus.number_count };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	bigint_limbs_copy(result.numbers, numbers, result.number_count);
+
+	bigint_helper_remove_leading_zeroes(&result);
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED bool bigint_is_special_modulus(BigIntC modulus) {
+
+	size_t bits = 0;
+	uint64_t offset = 0;
+
+	return bigint_helper_special_form(modulus, &bits, &offset);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntSpecialCtx bigint_special_ctx_from_form(size_t bits,
+                                                                              uint64_t offset) {
+
+	if(bits == 0 || bigint_helper_bits_of_number_used(offset) > bits / 2) {
+		UNREACHABLE_WITH_MSG("the offset of a special modulus can have at most bits / 2 bits");
+	}
+
+	BigIntC one = bigint_from_unsigned_number(1);
+	BigIntC power = bigint_shl(one, bits);
+
+	BigIntSpecialCtx ctx = {
+		.modulus = bigint_sub_u64(power, offset), .bits = bits, .offset = offset, .scratch = NULL
+	};
+
+	ctx.scratch =
+	    bigint_helper_allocate_scratch(bigint_helper_special_scratch_count(ctx.modulus.number_count));
+
+	free_bigint_without_reset(one);
+	free_bigint_without_reset(power);
+
+	return ctx;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntSpecialCtx bigint_special_ctx_from_modulus(BigIntC modulus) {
+
+	size_t bits = 0;
+	uint64_t offset = 0;
+
+	if(!bigint_helper_special_form(modulus, &bits, &offset)) {
+		UNREACHABLE_WITH_MSG("the modulus has to be of the form 2^k - c with a small c");
+	}
+
+	return bigint_special_ctx_from_form(bits, offset);
+}
+
+BIGINT_C_LIB_EXPORTED void free_bigint_special_ctx(BigIntSpecialCtx* ctx) {
+
+	if(ctx == NULL) {
+		return;
+	}
+
+	free_bigint(&(ctx->modulus));
+
+	free(ctx->scratch);
+	ctx->scratch = NULL;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mod_special(BigIntC big_int,
+                                                          BigIntSpecialCtx* ctx) {
+
+	const SpecialScratch scratch = bigint_helper_special_scratch(ctx);
+
+	bigint_helper_special_mod(scratch.current, big_int, ctx);
+
+	return bigint_helper_special_result(scratch.current, ctx);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mulmod_special(BigIntC big_int1, BigIntC big_int2,
+                                                             BigIntSpecialCtx* ctx) {
+
+	const size_t modulus_count = ctx->modulus.number_count;
+
+	if(big_int1.number_count > modulus_count || big_int2.number_count > modulus_count) {
+		// the product is too big for one reduction, so it is reduced in blocks
+		BigIntC product = bigint_mul_bigint(big_int1, big_int2);
+
+		BigIntC result = bigint_mod_special(product, ctx);
+
+		free_bigint_without_reset(product);
+
+		return result;
+	}
+
+	const SpecialScratch scratch = bigint_helper_special_scratch(ctx);
+
+	// the product is less than B^(2n), so it fits into the window
+	if(big_int1.number_count < big_int2.number_count) {
+		const BigIntC temp = big_int1;
+		big_int1 = big_int2;
+		big_int2 = temp;
+	}
+
+	bigint_mul_limbs(scratch.window, big_int1.numbers, big_int1.number_count, big_int2.numbers,
+	                 big_int2.number_count, scratch.kernel_scratch);
+
+	bigint_helper_special_reduce(scratch.current, scratch.window,
+	                             big_int1.number_count + big_int2.number_count, ctx);
+
+	if(big_int1.positive != big_int2.positive) {
+		bigint_helper_special_negate(scratch.current, ctx);
+	}
+
+	return bigint_helper_special_result(scratch.current, ctx);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_powm_special(BigIntC base, BigIntC exponent,
+                                                           BigIntSpecialCtx* ctx) {
+
+	if(!exponent.positive) {
+		UNREACHABLE_WITH_MSG("negative exponents are not supported");
+	}
+
+	const size_t count = ctx->modulus.number_count;
+
+	const size_t exponent_bits = bigint_helper_bit_length(exponent);
+
+	const SpecialScratch scratch = bigint_helper_special_scratch(ctx);
+
+	uint64_t* const table = scratch.table;
+	uint64_t* const current = scratch.current;
+
+	// 1 mod m, that is 0 modulo 1
+	memset(current, 0, sizeof(uint64_t) * count);
+	current[0] = 1;
+	bigint_helper_special_reduce(current, current, count, ctx);
+
+	if(exponent_bits == 0) {
+		return bigint_helper_special_result(current, ctx);
+	}
+
+	const size_t window_bits = helper_powm_window_bits(exponent_bits);
+	const size_t table_count = (size_t)1 << window_bits;
+
+	{ // 1. the table of base^i mod m for all i with window_bits bits
+
+		bigint_limbs_copy(table, current, count);
+
+		bigint_helper_special_mod(table + count, base, ctx);
+
+		for(size_t i = 2; i < table_count; ++i) {
+			bigint_helper_special_mul(table + (i * count), table + ((i - 1) * count),
+			                          table + count, ctx);
+		}
+	}
+
+	{ // 2. the windows from the top on, like in bigint_powm_mont
+
+		size_t position = exponent_bits - (exponent_bits % window_bits == 0
+		                                       ? window_bits
+		                                       : exponent_bits % window_bits);
+
+		const uint64_t top_window = helper_get_bits(exponent.numbers, exponent.number_count,
+		                                            position, exponent_bits - position);
+
+		bigint_limbs_copy(current, table + (top_window * count), count);
+
+		while(position != 0) {
+			position -= window_bits;
+
+			for(size_t i = 0; i < window_bits; ++i) {
+				bigint_helper_special_mul(current, current, current, ctx);
+			}
+
+			const uint64_t window =
+			    helper_get_bits(exponent.numbers, exponent.number_count, position, window_bits);
+
+			if(window != 0) {
+				bigint_helper_special_mul(current, current, table + (window * count), ctx);
+			}
+		}
+	}
+
+	return bigint_helper_special_result(current, ctx);
+}
+
+// base^exponent mod modulus with square and multiply and a full division after every step, this
+// is only used for even moduli, where montgomery arithmetic doesn't work
+NODISCARD static BigIntC bigint_helper_powm_with_division(BigIntC base, BigIntC exponent,
+                                                          BigIntC modulus) {
+
+	BigIntC one = bigint_from_unsigned_number(1);
+	BigIntC result = bigint_mod(one, modulus);
+	free_bigint_without_reset(one);
+
+	BigIntC power = bigint_mod_floor(base, modulus);
+
+	const size_t exponent_bits = bigint_helper_bit_length(exponent);
+
+	for(size_t i = 0; i < exponent_bits; ++i) {
+
+		if(((exponent.numbers[i / NUMBER_BIT_COUNT] >> (i % NUMBER_BIT_COUNT)) & 0x01) != 0) {
+			BigIntC product = bigint_mul_bigint(result, power);
+			bigint_helper_replace(&result, bigint_mod(product, modulus));
+			free_bigint_without_reset(product);
+		}
+
+		if(i + 1 < exponent_bits) {
+			BigIntC square = bigint_sqr(power);
+			bigint_helper_replace(&power, bigint_mod(square, modulus));
+			free_bigint_without_reset(square);
+		}
+	}
+
+	free_bigint_without_reset(power);
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_powm(BigIntC base, BigIntC exponent,
+                                                   BigIntC modulus) {
+
+	if(modulus.number_count == 1 && modulus.numbers[0] == 0) {
+		UNREACHABLE_WITH_MSG("division by zero");
+	}
+
+	if(!exponent.positive) {
+		UNREACHABLE_WITH_MSG("negative exponents are not supported");
+	}
+
+	// the result is in [0, |modulus|)
+	modulus.positive = true;
+
+	size_t special_bits = 0;
+	uint64_t special_offset = 0;
+
+	// moduli of the form 2^k - c are reduced without multiplications by the whole modulus, that
+	// includes even ones, like powers of two
+	if(bigint_helper_special_form(modulus, &special_bits, &special_offset)) {
+		BigIntSpecialCtx ctx = bigint_special_ctx_from_form(special_bits, special_offset);
+
+		BigIntC result = bigint_powm_special(base, exponent, &ctx);
+
+		free_bigint_special_ctx(&ctx);
+
+		return result;
+	}
+
+	if((modulus.numbers[0] & 0x01) == 0) {
+		return bigint_helper_powm_with_division(base, exponent, modulus);
+	}
+
+	BigIntMontCtx ctx = bigint_mont_ctx_from_modulus(modulus);
+
+	BigIntC result = bigint_powm_mont(base, exponent, &ctx);
+
+	free_bigint_mont_ctx(&ctx);
+
+	return result;
+}
+
+// fixed base exponentiation, with the comb method of Lim and Lee, "More flexible exponentiation
+// with precomputation", 1994: an exponent with t bits is written as h rows of a = ceil(t / h)
+// bits, e = sum(e_i * 2^(i * a)), then g^e = prod((g^(2^(i * a)))^e_i), all rows are processed
+// at the same time column by column, with the table of all 2^h products of the g^(2^(i * a)), so
+// that one exponentiation needs only a - 1 squarings and a multiplications
+
+// the table size is bounded by this, so that 2^teeth can't overflow
+#define FIXED_BASE_MAX_TEETH 24
+
+// the bits of the exponent at column, column + spacing, column + 2 * spacing, ...
+NODISCARD static size_t helper_comb_column(BigIntC exponent, size_t column, size_t spacing,
+                                           size_t teeth) {
+
+	size_t result = 0;
+
+	for(size_t i = 0; i < teeth; ++i) {
+		const size_t index = column + (i * spacing);
+		const size_t number_index = index / NUMBER_BIT_COUNT;
+
+		if(number_index < exponent.number_count &&
+		   ((exponent.numbers[number_index] >> (index % NUMBER_BIT_COUNT)) & 0x01) != 0) {
+			result |= (size_t)1 << i;
+		}
+	}
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntFixedBaseCtx bigint_fixed_base_ctx_from(BigIntC base,
+                                                                              BigIntC modulus,
+                                                                              size_t exponent_bits,
+                                                                              size_t memory_budget) {
+
+	BigIntFixedBaseCtx ctx = { .mont = bigint_mont_ctx_from_modulus(modulus),
+		                       .base = bigint_copy(base),
+		                       .exponent_bits = exponent_bits == 0 ? 1 : exponent_bits,
+		                       .teeth = 1,
+		                       .spacing = 0,
+		                       .table = NULL };
+
+	const size_t count = ctx.mont.modulus.number_count;
+	const size_t entry_size = sizeof(uint64_t) * count;
+
+	// the largest table, that fits into the budget, with at least 2 entries, more teeth than bits
+	// would only add unused rows
+	while(ctx.teeth < FIXED_BASE_MAX_TEETH && ctx.teeth < ctx.exponent_bits &&
+	      (memory_budget / entry_size) >> (ctx.teeth + 1) != 0) {
+		++ctx.teeth;
+	}
+
+	ctx.spacing = helper_ceil_div(ctx.exponent_bits, ctx.teeth);
+
+	const size_t table_count = (size_t)1 << ctx.teeth;
+
+	ctx.table = bigint_helper_allocate_scratch(table_count * count);
+
+	const MontScratch scratch = bigint_helper_mont_scratch(&ctx.mont);
+
+	// 1. table[2^i] = g^(2^(i * spacing)), every row is the previous one squared spacing times
+	bigint_helper_mont_one(ctx.table, &ctx.mont, scratch.product);
+
+	bigint_helper_mont_from_bigint(ctx.table + count, base, &ctx.mont, scratch);
+
+	for(size_t i = 1; i < ctx.teeth; ++i) {
+		uint64_t* const row = ctx.table + (((size_t)1 << i) * count);
+
+		bigint_limbs_copy(row, ctx.table + (((size_t)1 << (i - 1)) * count), count);
+
+		for(size_t j = 0; j < ctx.spacing; ++j) {
+			bigint_helper_mont_mul(row, row, row, &ctx.mont, scratch.product,
+			                       scratch.kernel_scratch);
+		}
+	}
+
+	// 2. every other entry is the entry without its highest bit times the row of that bit
+	for(size_t i = 3; i < table_count; ++i) {
+
+		const size_t top_bit = (size_t)1 << (bigint_helper_bits_of_number_used(i) - 1);
+
+		if(i == top_bit) {
+			continue;
+		}
+
+		bigint_helper_mont_mul(ctx.table + (i * count), ctx.table + ((i - top_bit) * count),
+		                       ctx.table + (top_bit * count), &ctx.mont, scratch.product,
+		                       scratch.kernel_scratch);
+	}
+
+	return ctx;
+}
+
+BIGINT_C_LIB_EXPORTED void free_bigint_fixed_base_ctx(BigIntFixedBaseCtx* ctx) {
+
+	if(ctx == NULL) {
+		return;
+	}
+
+	free_bigint_mont_ctx(&(ctx->mont));
+	free_bigint(&(ctx->base));
+
+	free(ctx->table);
+	ctx->table = NULL;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_powm_fixed_base(BigIntC exponent,
+                                                              BigIntFixedBaseCtx* ctx) {
+
+	if(!exponent.positive) {
+		UNREACHABLE_WITH_MSG("negative exponents are not supported");
+	}
+
+	if(bigint_helper_bit_length(exponent) > ctx->exponent_bits) {
+		// the table doesn't cover these bits
+		return bigint_powm_mont(ctx->base, exponent, &(ctx->mont));
+	}
+
+	const size_t count = ctx->mont.modulus.number_count;
+	const MontScratch scratch = bigint_helper_mont_scratch(&(ctx->mont));
+
+	uint64_t* const current = scratch.current;
+
+	// the columns from the top on, an empty column of the table is the montgomery form of 1
+	size_t column = ctx->spacing - 1;
+
+	bigint_limbs_copy(current,
+	                  ctx->table +
+	                      (helper_comb_column(exponent, column, ctx->spacing, ctx->teeth) * count),
+	                  count);
+
+	while(column != 0) {
+		--column;
+
+		bigint_helper_mont_mul(current, current, current, &(ctx->mont), scratch.product,
+		                       scratch.kernel_scratch);
+
+		const size_t entry = helper_comb_column(exponent, column, ctx->spacing, ctx->teeth);
+
+		if(entry != 0) {
+			bigint_helper_mont_mul(current, current, ctx->table + (entry * count), &(ctx->mont),
+			                       scratch.product, scratch.kernel_scratch);
+		}
+	}
+
+	return bigint_helper_mont_to_bigint(current, &(ctx->mont), scratch.product);
+}
+
+// simultaneous exponentiation, the product of several powers shares the squarings: with few bases,
+// every base gets its own window table and the windows of all exponents are multiplied in after
+// the same squarings (Straus, "Addition chains of vectors", 1964), with many bases, the bases are
+// sorted into buckets by the digit of their exponent, so that the tables aren't needed (Pippenger,
+// "On the evaluation of powers and related problems", 1976)
+
+// from this amount of bases on, the bucket method is used
+#ifndef BIGINT_MULTI_POWM_PIPPENGER_THRESHOLD
+#define BIGINT_MULTI_POWM_PIPPENGER_THRESHOLD 128
+#endif
+
+// the tables of the interleaved windows have 2^window_bits entries per base
+#define MULTI_POWM_MAX_WINDOW_BITS 4
+
+// the buckets have 2^digit_bits entries
+#define MULTI_POWM_MAX_DIGIT_BITS 16
+
+// bit_count bits of big_int from index on, bits above big_int are 0
+NODISCARD static uint64_t helper_get_bits_of_bigint(BigIntC big_int, size_t index,
+                                                    size_t bit_count) {
+
+	if(index / NUMBER_BIT_COUNT >= big_int.number_count) {
+		return U64(0);
+	}
+
+	return helper_get_bits(big_int.numbers, big_int.number_count, index, bit_count);
+}
+
+// current = prod(bases[i]^exponents[i]) with a table per base, current starts as R mod m
+static void bigint_helper_multi_powm_straus(uint64_t* current, const BigIntC* bases,
+                                            const BigIntC* exponents, size_t count,
+                                            size_t exponent_bits, BigIntMontCtx* ctx) {
+
+	const size_t modulus_count = ctx->modulus.number_count;
+	const MontScratch scratch = bigint_helper_mont_scratch(ctx);
+
+	const size_t window_bits = helper_min(helper_powm_window_bits(exponent_bits),
+	                                      MULTI_POWM_MAX_WINDOW_BITS);
+	const size_t table_count = (size_t)1 << window_bits;
+
+	// tables[i * table_count + j] = bases[i]^j * R mod m, the entry for j = 0 isn't used
+	uint64_t* const tables = bigint_helper_allocate_scratch(count * table_count * modulus_count);
+
+	{ // 1. the tables
+
+		for(size_t i = 0; i < count; ++i) {
+			uint64_t* const table = tables + (i * table_count * modulus_count);
+
+			bigint_helper_mont_from_bigint(table + modulus_count, bases[i], ctx, scratch);
+
+			for(size_t j = 2; j < table_count; ++j) {
+				bigint_helper_mont_mul(table + (j * modulus_count),
+				                       table + ((j - 1) * modulus_count), table + modulus_count,
+				                       ctx, scratch.product, scratch.kernel_scratch);
+			}
+		}
+	}
+
+	// 2. the windows from the top on, the squarings are shared by all bases
+	size_t position = helper_ceil_div(exponent_bits, window_bits) * window_bits;
+
+	while(position != 0) {
+		position -= window_bits;
+
+		for(size_t i = 0; i < window_bits; ++i) {
+			bigint_helper_mont_mul(current, current, current, ctx, scratch.product,
+			                       scratch.kernel_scratch);
+		}
+
+		for(size_t i = 0; i < count; ++i) {
+			const uint64_t window = helper_get_bits_of_bigint(exponents[i], position, window_bits);
+
+			if(window != 0) {
+				bigint_helper_mont_mul(
+				    current, current, tables + (((i * table_count) + window) * modulus_count), ctx,
+				    scratch.product, scratch.kernel_scratch);
+			}
+		}
+	}
+
+	free(tables);
+}
+
+// current = prod(bases[i]^exponents[i]) with buckets, current starts as R mod m
+static void bigint_helper_multi_powm_pippenger(uint64_t* current, const BigIntC* bases,
+                                               const BigIntC* exponents, size_t count,
+                                               size_t exponent_bits, BigIntMontCtx* ctx) {
+
+	const size_t modulus_count = ctx->modulus.number_count;
+	const MontScratch scratch = bigint_helper_mont_scratch(ctx);
+
+	// every window needs count multiplications for the buckets and 2 * 2^digit_bits to combine
+	// them, the digit size with the least multiplications overall is used
+	size_t digit_bits = 1;
+	size_t best_cost = SIZE_MAX;
+
+	for(size_t bits = 1; bits <= MULTI_POWM_MAX_DIGIT_BITS; ++bits) {
+		const size_t cost = helper_ceil_div(exponent_bits, bits) * (count + ((size_t)2 << bits));
+
+		if(cost < best_cost) {
+			best_cost = cost;
+			digit_bits = bits;
+		}
+	}
+
+	const size_t bucket_count = (size_t)1 << digit_bits;
+
+	// the bases in montgomery form, the buckets and the two running products
+	uint64_t* const memory = bigint_helper_allocate_scratch(
+	    (count + bucket_count + 2) * modulus_count);
+	bool* const bucket_used = (bool*)malloc(sizeof(bool) * bucket_count);
+
+	if(bucket_used == NULL) { // GCOVR_EXCL_BR_LINE (OOM)
+		UNREACHABLE_WITH_MSG( // GCOVR_EXCL_LINE (OOM content)
+		    "malloc failed, no error handling implemented here");
+	} // GCOVR_EXCL_LINE (OOM content)
+
+	uint64_t* const converted = memory;
+	uint64_t* const buckets = converted + (count * modulus_count);
+	uint64_t* const running = buckets + (bucket_count * modulus_count);
+	uint64_t* const sum = running + modulus_count;
+
+	for(size_t i = 0; i < count; ++i) {
+		bigint_helper_mont_from_bigint(converted + (i * modulus_count), bases[i], ctx, scratch);
+	}
+
+	size_t position = helper_ceil_div(exponent_bits, digit_bits) * digit_bits;
+
+	while(position != 0) {
+		position -= digit_bits;
+
+		for(size_t i = 0; i < digit_bits; ++i) {
+			bigint_helper_mont_mul(current, current, current, ctx, scratch.product,
+			                       scratch.kernel_scratch);
+		}
+
+		// 1. every base goes into the bucket of its digit, empty buckets are 1 and aren't
+		// multiplied
+		memset(bucket_used, 0, sizeof(bool) * bucket_count);
+
+		for(size_t i = 0; i < count; ++i) {
+			const uint64_t digit = helper_get_bits_of_bigint(exponents[i], position, digit_bits);
+
+			if(digit == 0) {
+				continue;
+			}
+
+			uint64_t* const bucket = buckets + (digit * modulus_count);
+			const uint64_t* const base = converted + (i * modulus_count);
+
+			if(bucket_used[digit]) {
+				bigint_helper_mont_mul(bucket, bucket, base, ctx, scratch.product,
+				                       scratch.kernel_scratch);
+			} else {
+				bigint_limbs_copy(bucket, base, modulus_count);
+				bucket_used[digit] = true;
+			}
+		}
+
+		// 2. prod(bucket[d]^d) = prod over d of (prod of the buckets from d on), from the top on
+		bool running_used = false;
+		bool sum_used = false;
+
+		for(size_t digit = bucket_count - 1; digit != 0; --digit) {
+
+			if(bucket_used[digit]) {
+				if(running_used) {
+					bigint_helper_mont_mul(running, running, buckets + (digit * modulus_count),
+					                       ctx, scratch.product, scratch.kernel_scratch);
+				} else {
+					bigint_limbs_copy(running, buckets + (digit * modulus_count), modulus_count);
+					running_used = true;
+				}
+			}
+
+			if(!running_used) {
+				continue;
+			}
+
+			if(sum_used) {
+				bigint_helper_mont_mul(sum, sum, running, ctx, scratch.product,
+				                       scratch.kernel_scratch);
+			} else {
+				bigint_limbs_copy(sum, running, modulus_count);
+				sum_used = true;
+			}
+		}
+
+		if(sum_used) {
+			bigint_helper_mont_mul(current, current, sum, ctx, scratch.product,
+			                       scratch.kernel_scratch);
+		}
+	}
+
+	free(bucket_used);
+	free(memory);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_multi_powm(const BigIntC* bases,
+                                                         const BigIntC* exponents, size_t count,
+                                                         BigIntMontCtx* ctx) {
+
+	size_t exponent_bits = 0;
+
+	for(size_t i = 0; i < count; ++i) {
+		if(!exponents[i].positive) {
+			UNREACHABLE_WITH_MSG("negative exponents are not supported");
+		}
+
+		const size_t bits = bigint_helper_bit_length(exponents[i]);
+		exponent_bits = bits > exponent_bits ? bits : exponent_bits;
+	}
+
+	const MontScratch scratch = bigint_helper_mont_scratch(ctx);
+
+	// the current value is the montgomery form of 1 at the start, so an empty product is 1, the
+	// table of the context is free, as the bases get their own tables and the current value of the
+	// scratch memory is used by the conversion of the bases
+	uint64_t* const current = scratch.table;
+	bigint_helper_mont_one(current, ctx, scratch.product);
+
+	if(exponent_bits != 0) {
+		if(count < BIGINT_MULTI_POWM_PIPPENGER_THRESHOLD) {
+			bigint_helper_multi_powm_straus(current, bases, exponents, count, exponent_bits, ctx);
+		} else {
+			bigint_helper_multi_powm_pippenger(current, bases, exponents, count, exponent_bits,
+			                                   ctx);
+		}
+	}
+
+	return bigint_helper_mont_to_bigint(current, ctx, scratch.product);
+}
+
+// barrett reduction
+
+// with the reciprocal mu = floor(B^(2n) / m) of a modulus with n numbers, the quotient of every
+// x < B^(2n) can be estimated with one multiplication as
+// q = floor(floor(x / B^(n - 1)) * mu / B^(n + 1)), which is at most 2 too small, so the remainder
+// x - q * m only needs a second multiplication and at most two subtractions, see "Implementing the
+// Rivest Shamir and Adleman public key encryption algorithm on a standard digital signal
+// processor" by Barrett, 1986
+
+// the numbers of the scratch memory of a context for a modulus with this many numbers and a
+// reciprocal with reciprocal_count numbers (at most count + 2): the window of 2n numbers, the
+// estimate of the quotient, the product of the quotient and the modulus, the remainder and the
+// scratch of the multiplication kernels, no factor has more than count + 2 numbers and the scratch
+// of bigint_mul_limbs is the largest for balanced factors
+NODISCARD static size_t bigint_helper_barrett_scratch_count(size_t count, size_t reciprocal_count) {
+
+	const size_t estimate_count = (count + 1) + reciprocal_count;
+	const size_t quotient_count = estimate_count - (count + 1);
+
+	return (2 * count) + estimate_count + (quotient_count + count) + (count + 1) +
+	       bigint_mul_limbs_scratch_count(count + 2, count + 2);
+}
+
+typedef struct {
+	uint64_t* window;
+	uint64_t* estimate;
+	uint64_t* product;
+	uint64_t* remainder;
+	uint64_t* kernel_scratch;
+} BarrettScratch;
+
+NODISCARD static BarrettScratch bigint_helper_barrett_scratch(const BigIntBarrettCtx* ctx) {
+
+	const size_t count = ctx->modulus.number_count;
+	const size_t estimate_count = (count + 1) + ctx->reciprocal.number_count;
+
+	BarrettScratch scratch = { .window = ctx->scratch,
+		                       .estimate = NULL,
+		                       .product = NULL,
+		                       .remainder = NULL,
+		                       .kernel_scratch = NULL };
+
+	scratch.estimate = scratch.window + (2 * count);
+	scratch.product = scratch.estimate + estimate_count;
+	scratch.remainder = scratch.product + (estimate_count - (count + 1) + count);
+	scratch.kernel_scratch = scratch.remainder + (count + 1);
+
+	return scratch;
+}
+
+// for smaller moduli, only the needed parts of the two products are computed with the schoolbook
+// method, that is half the work of the full products, above it the full products with karatsuba
+// are faster
+#ifndef BIGINT_BARRETT_KARATSUBA_THRESHOLD
+#define BIGINT_BARRETT_KARATSUBA_THRESHOLD BIGINT_MUL_KARATSUBA_THRESHOLD
+#endif
+
+// result[0..count1 + count2] gets all partial products of numbers1 * numbers2 at positions from
+// skip on, the dropped ones make the result at most count1 + count2 too small at position skip,
+// so the quotient estimate is at most one smaller, the lower numbers of the result are garbage
+static void bigint_helper_mul_high_schoolbook(uint64_t* result, const uint64_t* numbers1,
+                                              size_t count1, const uint64_t* numbers2,
+                                              size_t count2, size_t skip) {
+
+	memset(result, 0, sizeof(uint64_t) * (count1 + count2));
+
+	for(size_t i = 0; i < count2; ++i) {
+		const size_t start = skip > i ? helper_min(skip - i, count1) : 0;
+
+		// the top limb of this row was never written before, so it can just be set
+		result[i + count1] = bigint_limbs_addmul_1(result + i + start, numbers1 + start,
+		                                           count1 - start, numbers2[i]);
+	}
+}
+
+// result[0..count) = numbers1 * numbers2 mod B^count
+static void bigint_helper_mul_low_schoolbook(uint64_t* result, const uint64_t* numbers1,
+                                             size_t count1, const uint64_t* numbers2,
+                                             size_t count2, size_t count) {
+
+	memset(result, 0, sizeof(uint64_t) * count);
+
+	for(size_t i = 0; i < count2 && i < count; ++i) {
+		const size_t row_count = helper_min(count1, count - i);
+
+		const uint64_t carry =
+		    bigint_limbs_addmul_1(result + i, numbers1, row_count, numbers2[i]);
+
+		if(i + row_count < count) {
+			result[i + row_count] = carry;
+		}
+	}
+}
+
+// result[0..n) = numbers[0..count) mod m, with count <= 2n, result can be the same as numbers or
+// point into it, as it is only written at the end
+static void bigint_helper_barrett_reduce(uint64_t* result, const uint64_t* numbers, size_t count,
+                                         const BigIntBarrettCtx* ctx) {
+
+	const size_t modulus_count = ctx->modulus.number_count;
+
+	ASSERT(count <= 2 * modulus_count, "the numbers have to be less than B^(2n)");
+
+	const BarrettScratch scratch = bigint_helper_barrett_scratch(ctx);
+
+	uint64_t* const remainder = scratch.remainder;
+
+	// 1. the low n + 1 numbers of x, the remainder is less than 3 * m < B^(n + 1), so the higher
+	// numbers cancel out
+	const size_t low_count = helper_min(count, modulus_count + 1);
+
+	memset(remainder, 0, sizeof(uint64_t) * (modulus_count + 1));
+	bigint_limbs_copy(remainder, numbers, low_count);
+
+	if(count >= modulus_count) {
+
+		// 2. the estimate floor(x / B^(n - 1)) * mu
+		const uint64_t* const top = numbers + (modulus_count - 1);
+		const size_t top_count = count - (modulus_count - 1);
+
+		const BigIntC reciprocal = ctx->reciprocal;
+
+		const size_t estimate_count = top_count + reciprocal.number_count;
+
+		const bool truncated = modulus_count < BIGINT_BARRETT_KARATSUBA_THRESHOLD;
+
+		if(truncated) {
+			// only the numbers from n + 1 on are needed, the carries from the positions below
+			// n - 1 are at most 1 together
+			bigint_helper_mul_high_schoolbook(scratch.estimate, reciprocal.numbers,
+			                                  reciprocal.number_count, top, top_count,
+			                                  modulus_count - 1);
+		} else if(top_count >= reciprocal.number_count) {
+			bigint_mul_limbs(scratch.estimate, top, top_count, reciprocal.numbers,
+			                 reciprocal.number_count, scratch.kernel_scratch);
+		} else {
+			bigint_mul_limbs(scratch.estimate, reciprocal.numbers, reciprocal.number_count, top,
+			                 top_count, scratch.kernel_scratch);
+		}
+
+		// 3. the quotient floor(estimate / B^(n + 1)), if it isn't 0, x - quotient * m modulo
+		// B^(n + 1)
+		if(estimate_count > modulus_count + 1) {
+			const uint64_t* const quotient = scratch.estimate + (modulus_count + 1);
+			const size_t quotient_count =
+			    helper_normalized_count(quotient, estimate_count - (modulus_count + 1));
+
+			if(truncated) {
+				bigint_helper_mul_low_schoolbook(scratch.product, ctx->modulus.numbers,
+				                                 modulus_count, quotient, quotient_count,
+				                                 modulus_count + 1);
+			} else if(quotient_count >= modulus_count) {
+				bigint_mul_limbs(scratch.product, quotient, quotient_count, ctx->modulus.numbers,
+				                 modulus_count, scratch.kernel_scratch);
+			} else {
+				bigint_mul_limbs(scratch.product, ctx->modulus.numbers, modulus_count, quotient,
+				                 quotient_count, scratch.kernel_scratch);
+			}
+
+			const uint64_t borrow = bigint_limbs_sub_n(remainder, remainder, scratch.product,
+			                                           modulus_count + 1);
+			UNUSED(borrow);
+		}
+	}
+
+	// 4. the estimate was at most 2 too small (3 with the truncated product)
+	while(remainder[modulus_count] != 0 ||
+	      bigint_limbs_cmp(remainder, ctx->modulus.numbers, modulus_count) >= 0) {
+		const uint64_t borrow =
+		    bigint_limbs_sub_n(remainder, remainder, ctx->modulus.numbers, modulus_count);
+
+		remainder[modulus_count] -= borrow;
+	}
+
+	bigint_limbs_copy(result, remainder, modulus_count);
+}
+
+// returns the remainder in [0, m) of a number with that sign, numbers is the remainder of its
+// absolute value and has n numbers
+NODISCARD static BigIntC bigint_helper_barrett_result(const uint64_t* numbers, bool positive,
+                                                      const BigIntBarrettCtx* ctx) {
+
+	const size_t modulus_count = ctx->modulus.number_count;
+
+	BigIntC result = { .positive = true, .numbers = NULL, .number_count = modulus_count };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	const bool is_zero = helper_normalized_count(numbers, modulus_count) == 1 && numbers[0] == 0;
+
+	if(positive || is_zero) {
+		bigint_limbs_copy(result.numbers, numbers, modulus_count);
+	} else {
+		// -x mod m = m - (x mod m)
+		const uint64_t borrow =
+		    bigint_limbs_sub_n(result.numbers, ctx->modulus.numbers, numbers, modulus_count);
+		UNUSED(borrow);
+	}
+
+	bigint_helper_remove_leading_zeroes(&result);
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntBarrettCtx bigint_barrett_ctx_from_modulus(BigIntC modulus) {
+
+	if(modulus.number_count == 1 && modulus.numbers[0] == 0) {
+		UNREACHABLE_WITH_MSG("division by zero");
+	}
+
+	modulus.positive = true;
+
+	const size_t count = modulus.number_count;
+
+	BigIntBarrettCtx ctx = { .modulus = bigint_copy(modulus),
+		                     .reciprocal = bigint_reciprocal(modulus, 2 * NUMBER_BIT_COUNT * count),
+		                     .scratch = NULL };
+
+	ctx.scratch = bigint_helper_allocate_scratch(
+	    bigint_helper_barrett_scratch_count(count, ctx.reciprocal.number_count));
+
+	return ctx;
+}
+
+BIGINT_C_LIB_EXPORTED void free_bigint_barrett_ctx(BigIntBarrettCtx* ctx) {
+
+	if(ctx == NULL) {
+		return;
+	}
+
+	free_bigint(&(ctx->modulus));
+	free_bigint(&(ctx->reciprocal));
+
+	free(ctx->scratch);
+	ctx->scratch = NULL;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mod_barrett(BigIntC big_int,
+                                                          BigIntBarrettCtx* ctx) {
+
+	const size_t modulus_count = ctx->modulus.number_count;
+	const BarrettScratch scratch = bigint_helper_barrett_scratch(ctx);
+
+	// the remainder is built in the upper half of the window, if x has more than 2n numbers, it is
+	// reduced in blocks of n numbers from the top on, like a long division with a digit of n
+	// numbers, every window r * B^n + block is less than m * B^n < B^(2n)
+	uint64_t* const window = scratch.window;
+	uint64_t* const current = window + modulus_count;
+
+	size_t block_count = 0;
+
+	if(big_int.number_count > 2 * modulus_count) {
+		block_count = helper_ceil_div(big_int.number_count - (2 * modulus_count), modulus_count);
+	}
+
+	const size_t top_offset = block_count * modulus_count;
+
+	bigint_helper_barrett_reduce(current, big_int.numbers + top_offset,
+	                             big_int.number_count - top_offset, ctx);
+
+	for(size_t i = block_count; i != 0; --i) {
+		bigint_limbs_copy(window, big_int.numbers + ((i - 1) * modulus_count), modulus_count);
+
+		bigint_helper_barrett_reduce(current, window, 2 * modulus_count, ctx);
+	}
+
+	return bigint_helper_barrett_result(current, big_int.positive, ctx);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mulmod_barrett(BigIntC big_int1, BigIntC big_int2,
+                                                             BigIntBarrettCtx* ctx) {
+
+	const size_t modulus_count = ctx->modulus.number_count;
+
+	const bool positive = big_int1.positive == big_int2.positive;
+
+	if(big_int1.number_count > modulus_count || big_int2.number_count > modulus_count) {
+		// the product is too big for one reduction, so it is reduced in blocks
+		BigIntC product = bigint_mul_bigint(big_int1, big_int2);
+
+		BigIntC result = bigint_mod_barrett(product, ctx);
+
+		free_bigint_without_reset(product);
+
+		return result;
+	}
+
+	const BarrettScratch scratch = bigint_helper_barrett_scratch(ctx);
+
+	// the product is less than B^(2n), so it fits into the window
+	if(big_int1.number_count < big_int2.number_count) {
+		const BigIntC temp = big_int1;
+		big_int1 = big_int2;
+		big_int2 = temp;
+	}
+
+	bigint_mul_limbs(scratch.window, big_int1.numbers, big_int1.number_count, big_int2.numbers,
+	                 big_int2.number_count, scratch.kernel_scratch);
+
+	const size_t product_count = big_int1.number_count + big_int2.number_count;
+
+	bigint_helper_barrett_reduce(scratch.window, scratch.window, product_count, ctx);
+
+	return bigint_helper_barrett_result(scratch.window, positive, ctx);
+}
+
+// greatest common divisor, with the lehmer algorithm (Lehmer, "Euclid's algorithm for large
+// numbers", 1938) with approximations of two numbers (Jebelean, "Improving the multiprecision
+// euclidean algorithm", 1993): the euclidean algorithm is run on the top 128 bits, as long as the
+// quotients are known to be the same as the ones of the full numbers, and the collected steps are
+// applied to the full numbers at once, that removes about 64 bits with two linear passes, once
+// the numbers fit into two numbers, the binary algorithm is used for the gcd alone
+
+// a number with two numbers for the approximations, this doesn't use uint128_t, so that it works
+// with both implementations
+typedef struct {
+	uint64_t high;
+	uint64_t low;
+} DoubleNumber;
+
+NODISCARD static bool helper_double_is_zero(DoubleNumber number) {
+	return number.high == 0 && number.low == 0;
+}
+
+NODISCARD static bool helper_double_less(DoubleNumber number1, DoubleNumber number2) {
+	return number1.high < number2.high ||
+	       (number1.high == number2.high && number1.low < number2.low);
+}
+
+NODISCARD static DoubleNumber helper_double_add(DoubleNumber number1, DoubleNumber number2) {
+
+	DoubleNumber result = { .high = 0, .low = 0 };
+
+	const uint8_t carry = bigint_helper_add_uint64_with_carry(0, number1.low, number2.low,
+	                                                          &(result.low));
+	result.high = number1.high + number2.high + carry;
+
+	return result;
+}
+
+NODISCARD static DoubleNumber helper_double_sub(DoubleNumber number1, DoubleNumber number2) {
+
+	const DoubleNumber result = { .high = number1.high - number2.high -
+		                                  (number1.low < number2.low ? 1 : 0),
+		                          .low = number1.low - number2.low };
+
+	return result;
+}
+
+NODISCARD static size_t helper_double_bits(DoubleNumber number) {
+
+	if(number.high != 0) {
+		return NUMBER_BIT_COUNT + bigint_helper_bits_of_number_used(number.high);
+	}
+
+	return bigint_helper_bits_of_number_used(number.low);
+}
+
+// the amount of trailing zero bits, the number can't be 0
+NODISCARD static size_t helper_double_trailing_zeros(DoubleNumber number) {
+
+	if(number.low != 0) {
+		return helper_count_trailing_zeros(number.low);
+	}
+
+	return NUMBER_BIT_COUNT + helper_count_trailing_zeros(number.high);
+}
+
+// amount has to be less than 128
+NODISCARD static DoubleNumber helper_double_shift_left(DoubleNumber number, size_t amount) {
+
+	if(amount == 0) {
+		return number;
+	}
+
+	if(amount >= NUMBER_BIT_COUNT) {
+		const DoubleNumber result = { .high = number.low << (amount - NUMBER_BIT_COUNT), .low = 0 };
+		return result;
+	}
+
+	const DoubleNumber result = { .high = (number.high << amount) |
+		                                  (number.low >> (NUMBER_BIT_COUNT - amount)),
+		                          .low = number.low << amount };
+
+	return result;
+}
+
+// amount has to be less than 128
+NODISCARD static DoubleNumber helper_double_shift_right(DoubleNumber number, size_t amount) {
+
+	if(amount == 0) {
+		return number;
+	}
+
+	if(amount >= NUMBER_BIT_COUNT) {
+		const DoubleNumber result = { .high = 0, .low = number.high >> (amount - NUMBER_BIT_COUNT) };
+		return result;
+	}
+
+	const DoubleNumber result = { .high = number.high >> amount,
+		                          .low = (number.low >> amount) |
+		                                 (number.high << (NUMBER_BIT_COUNT - amount)) };
+
+	return result;
+}
+
+// quotient = floor(number1 / number2), rest = number1 mod number2, returns false, if the quotient
+// doesn't fit into one number, this is a binary long division with as many steps as the quotient
+// has bits, most quotients of the euclidean algorithm are small, so that is only a few steps
+NODISCARD static bool helper_double_divrem(DoubleNumber number1, DoubleNumber number2,
+                                           uint64_t* quotient, DoubleNumber* rest) {
+
+	ASSERT(!helper_double_is_zero(number2), "division by zero");
+
+	*quotient = 0;
+
+	if(helper_double_less(number1, number2)) {
+		*rest = number1;
+		return true;
+	}
+
+	const size_t shift = helper_double_bits(number1) - helper_double_bits(number2);
+
+	if(shift >= NUMBER_BIT_COUNT) {
+		return false;
+	}
+
+	DoubleNumber divisor = helper_double_shift_left(number2, shift);
+
+	for(size_t i = 0; i <= shift; ++i) {
+		*quotient = *quotient << 1;
+
+		if(!helper_double_less(number1, divisor)) {
+			number1 = helper_double_sub(number1, divisor);
+			*quotient = *quotient | U64(1);
+		}
+
+		divisor = helper_double_shift_right(divisor, 1);
+	}
+
+	*rest = number1;
+	return true;
+}
+
+// result = previous + quotient * current, returns false, if that doesn't fit into one number
+NODISCARD static bool helper_cofactor_step(uint64_t previous, uint64_t current, uint64_t quotient,
+                                           uint64_t* result) {
+
+	uint64_t low = U64(0);
+	uint64_t high = U64(0);
+
+	bigint_mul_two_numbers_impl(quotient, current, &low, &high);
+
+	if(high != 0) {
+		return false;
+	}
+
+	return bigint_helper_add_uint64_with_carry(0, low, previous, result) == 0;
+}
+
+// the combined steps of the euclidean algorithm on the approximations, the new numbers are
+// a' = |first_a * a - first_b * b| and b' = |second_a * a - second_b * b|, the signs of the
+// cofactors alternate from step to step, so only the magnitudes are stored
+typedef struct {
+	uint64_t first_a;
+	uint64_t first_b;
+	uint64_t second_a;
+	uint64_t second_b;
+	size_t steps;
+} GcdMatrix;
+
+// runs the euclidean algorithm on approximation1 >= approximation2, if they are the top bits of
+// the full numbers a and b, at the same position, every step is only taken, if its quotient is the
+// same as the one of the full numbers: a = 2^h * x + e1, b = 2^h * y + e2 with 0 <= e1, e2 < 2^h,
+// then the full remainders differ from 2^h * the approximations by less than 2^h * the larger
+// cofactor, that is the one of b, so the quotient is right, if the new remainder is at least
+// that cofactor and the difference to the current remainder is at least the sum of both cofactors,
+// every new remainder also has to be at least limit + that cofactor, so that the full remainder is
+// at least 2^h * limit
+NODISCARD static GcdMatrix bigint_helper_gcd_matrix(DoubleNumber approximation1,
+                                                    DoubleNumber approximation2, bool exact,
+                                                    DoubleNumber limit) {
+
+	GcdMatrix matrix = { .first_a = 1,
+		                 .first_b = 0,
+		                 .second_a = 0,
+		                 .second_b = 1,
+		                 .steps = 0 };
+
+	while(!helper_double_is_zero(approximation2)) {
+		uint64_t quotient = U64(0);
+		DoubleNumber rest = { .high = 0, .low = 0 };
+
+		if(!helper_double_divrem(approximation1, approximation2, &quotient, &rest)) {
+			break;
+		}
+
+		uint64_t next_a = U64(0);
+		uint64_t next_b = U64(0);
+
+		if(!helper_cofactor_step(matrix.first_a, matrix.second_a, quotient, &next_a) ||
+		   !helper_cofactor_step(matrix.first_b, matrix.second_b, quotient, &next_b)) {
+			break;
+		}
+
+		const DoubleNumber next_cofactor = { .high = 0, .low = exact ? 0 : next_b };
+
+		if(helper_double_less(rest, helper_double_add(limit, next_cofactor))) {
+			break;
+		}
+
+		if(!exact) {
+			const DoubleNumber current_cofactor = { .high = 0, .low = matrix.second_b };
+
+			if(helper_double_less(helper_double_sub(approximation2, rest),
+			                      helper_double_add(next_cofactor, current_cofactor))) {
+				break;
+			}
+		}
+
+		matrix.first_a = matrix.second_a;
+		matrix.first_b = matrix.second_b;
+		matrix.second_a = next_a;
+		matrix.second_b = next_b;
+		++matrix.steps;
+
+		approximation1 = approximation2;
+		approximation2 = rest;
+	}
+
+	return matrix;
+}
+
+// 64 bits of numbers from index on, bits above the numbers are 0
+NODISCARD static uint64_t helper_get_number_at_bit(const uint64_t* numbers, size_t count,
+                                                   size_t index) {
+
+	const size_t number_index = index / NUMBER_BIT_COUNT;
+	const size_t offset = index % NUMBER_BIT_COUNT;
+
+	if(number_index >= count) {
+		return U64(0);
+	}
+
+	uint64_t value = numbers[number_index] >> offset;
+
+	if(offset != 0 && number_index + 1 < count) {
+		value |= numbers[number_index + 1] << (NUMBER_BIT_COUNT - offset);
+	}
+
+	return value;
+}
+
+NODISCARD static DoubleNumber helper_double_at_bit(BigIntC big_int, size_t index) {
+
+	const DoubleNumber result = {
+		.high = helper_get_number_at_bit(big_int.numbers, big_int.number_count,
+		                                 index + NUMBER_BIT_COUNT),
+		.low = helper_get_number_at_bit(big_int.numbers, big_int.number_count, index)
+	};
+
+	return result;
+}
+
+// the binary gcd (Stein, 1967), both can't be 0
+NODISCARD static DoubleNumber helper_double_binary_gcd(DoubleNumber number1,
+                                                       DoubleNumber number2) {
+
+	const size_t zeros1 = helper_double_trailing_zeros(number1);
+	const size_t zeros2 = helper_double_trailing_zeros(number2);
+
+	number1 = helper_double_shift_right(number1, zeros1);
+
+	// both are odd after the shifts, so the difference is even and gets shifted again
+	do {
+		number2 = helper_double_shift_right(number2, helper_double_trailing_zeros(number2));
+
+		if(helper_double_less(number2, number1)) {
+			const DoubleNumber temp = number1;
+			number1 = number2;
+			number2 = temp;
+		}
+
+		number2 = helper_double_sub(number2, number1);
+	} while(!helper_double_is_zero(number2));
+
+	return helper_double_shift_left(number1, zeros1 < zeros2 ? zeros1 : zeros2);
+}
+
+// result = x * factor_x - y * factor_y for the signed x and y, result needs max(count of x,
+// count of y) + 2 numbers and can't overlap with them
+static void bigint_helper_gcd_combine(BigIntC* result, BigIntC big_int_x, uint64_t factor_x,
+                                      BigIntC big_int_y, uint64_t factor_y) {
+
+	const size_t count = (big_int_x.number_count > big_int_y.number_count
+	                          ? big_int_x.number_count
+	                          : big_int_y.number_count) +
+	                     2;
+
+	uint64_t* const numbers = result->numbers;
+
+	memset(numbers, 0, sizeof(uint64_t) * count);
+
+	numbers[big_int_x.number_count] =
+	    bigint_limbs_mul_1(numbers, big_int_x.numbers, big_int_x.number_count, factor_x);
+
+	// the second term has the opposite sign of y
+	bool positive = big_int_x.positive;
+
+	if(big_int_x.positive != big_int_y.positive) {
+		const uint64_t carry =
+		    bigint_limbs_addmul_1(numbers, big_int_y.numbers, big_int_y.number_count, factor_y);
+
+		const uint64_t overflow =
+		    bigint_limbs_add_1(numbers + big_int_y.number_count, numbers + big_int_y.number_count,
+		                       count - big_int_y.number_count, carry);
+		ASSERT(overflow == 0, "the sum has to fit");
+		UNUSED(overflow);
+	} else {
+		const uint64_t borrow =
+		    bigint_limbs_submul_1(numbers, big_int_y.numbers, big_int_y.number_count, factor_y);
+
+		const uint64_t negative =
+		    bigint_limbs_sub_1(numbers + big_int_y.number_count, numbers + big_int_y.number_count,
+		                       count - big_int_y.number_count, borrow);
+
+		if(negative != 0) {
+			// the two's complement is the magnitude of the negative difference
+			for(size_t i = 0; i < count; ++i) {
+				numbers[i] = ~numbers[i];
+			}
+
+			const uint64_t carry = bigint_limbs_add_1(numbers, numbers, count, 1);
+			UNUSED(carry);
+
+			positive = !positive;
+		}
+	}
+
+	result->number_count = helper_normalized_count(numbers, count);
+	result->positive = positive || (result->number_count == 1 && numbers[0] == 0);
+}
+
+// copies the value of big_int into the buffer of target
+static void bigint_helper_gcd_assign(BigIntC* target, BigIntC big_int) {
+
+	bigint_limbs_copy(target->numbers, big_int.numbers, big_int.number_count);
+	target->number_count = big_int.number_count;
+	target->positive = big_int.positive;
+}
+
+NODISCARD static bool bigint_helper_is_zero(BigIntC big_int) {
+	return big_int.number_count == 1 && big_int.numbers[0] == 0;
+}
+
+// the lehmer steps for bigint_helper_gcd, the numbers and their cofactors are kept in scratch
+// buffers, that are swapped after every step, only division steps allocate, that are needed, if
+// the approximations give no step, for example at the start, if the numbers have very different
+// sizes
+NODISCARD static BigIntC bigint_helper_gcd_lehmer(BigIntC big_int1, BigIntC big_int2,
+                                                  BigIntC* factor) {
+
+	const size_t capacity =
+	    (big_int1.number_count > big_int2.number_count ? big_int1.number_count
+	                                                   : big_int2.number_count) +
+	    3;
+
+	uint64_t* const scratch = bigint_helper_allocate_scratch(8 * capacity);
+
+	BigIntC buffers[8];
+
+	for(size_t i = 0; i < 8; ++i) {
+		const BigIntC buffer = { .positive = true,
+			                     .numbers = scratch + (i * capacity),
+			                     .number_count = 1 };
+		buffers[i] = buffer;
+		buffers[i].numbers[0] = 0;
+	}
+
+	// a >= b, with the cofactors of big_int1, a = factor_a * |big_int1| mod |big_int2|
+	BigIntC* current_a = &(buffers[0]);
+	BigIntC* current_b = &(buffers[1]);
+	BigIntC* factor_a = &(buffers[2]);
+	BigIntC* factor_b = &(buffers[3]);
+	BigIntC* next_a = &(buffers[4]);
+	BigIntC* next_b = &(buffers[5]);
+	BigIntC* next_factor_a = &(buffers[6]);
+	BigIntC* next_factor_b = &(buffers[7]);
+
+	big_int1.positive = true;
+	big_int2.positive = true;
+
+	bigint_helper_gcd_assign(current_a, big_int1);
+	bigint_helper_gcd_assign(current_b, big_int2);
+
+	factor_a->numbers[0] = bigint_helper_is_zero(big_int1) ? 0 : 1;
+
+	if(bigint_compare_bigint(*current_a, *current_b) < 0) {
+		BigIntC* temp = current_a;
+		current_a = current_b;
+		current_b = temp;
+
+		temp = factor_a;
+		factor_a = factor_b;
+		factor_b = temp;
+	}
+
+	BigIntC result = { .positive = true, .numbers = NULL, .number_count = 0 };
+
+	while(!bigint_helper_is_zero(*current_b)) {
+
+		const bool exact = current_a->number_count <= 2;
+
+		// 1. the gcd of numbers with at most two numbers
+		if(exact && factor == NULL) {
+			const DoubleNumber gcd = helper_double_binary_gcd(helper_double_at_bit(*current_a, 0),
+			                                                  helper_double_at_bit(*current_b, 0));
+
+			const uint64_t gcd_numbers[] = { gcd.high, gcd.low };
+			result = bigint_from_list_of_numbers(gcd_numbers, 2);
+			break;
+		}
+
+		// 2. the steps from the top 128 bits
+		const size_t bits = bigint_helper_bit_length(*current_a);
+		const size_t index = exact ? 0 : bits - (2 * NUMBER_BIT_COUNT);
+
+		const DoubleNumber no_limit = { .high = 0, .low = 0 };
+
+		const GcdMatrix matrix =
+		    bigint_helper_gcd_matrix(helper_double_at_bit(*current_a, index),
+		                             helper_double_at_bit(*current_b, index), exact, no_limit);
+
+		if(matrix.steps != 0) {
+			bigint_helper_gcd_combine(next_a, *current_a, matrix.first_a, *current_b,
+			                          matrix.first_b);
+			bigint_helper_gcd_combine(next_b, *current_a, matrix.second_a, *current_b,
+			                          matrix.second_b);
+
+			if(factor != NULL) {
+				bigint_helper_gcd_combine(next_factor_a, *factor_a, matrix.first_a, *factor_b,
+				                          matrix.first_b);
+				bigint_helper_gcd_combine(next_factor_b, *factor_a, matrix.second_a, *factor_b,
+				                          matrix.second_b);
+
+				// the numbers are made positive, so their cofactors get the sign of the
+				// differences
+				if(!next_a->positive) {
+					bigint_negate(next_factor_a);
+				}
+
+				if(!next_b->positive) {
+					bigint_negate(next_factor_b);
+				}
+			}
+
+			next_a->positive = true;
+			next_b->positive = true;
+		} else {
+			// 3. one division step, if the quotient is too big for the approximations
+			BigIntDivModC divmod = bigint_divmod_both_positive(*current_a, *current_b);
+
+			bigint_helper_gcd_assign(next_a, *current_b);
+			bigint_helper_gcd_assign(next_b, divmod.remainder);
+
+			if(factor != NULL) {
+				BigIntC product = bigint_mul_bigint(divmod.quotient, *factor_b);
+				BigIntC difference = bigint_sub_bigint(*factor_a, product);
+
+				bigint_helper_gcd_assign(next_factor_a, *factor_b);
+				bigint_helper_gcd_assign(next_factor_b, difference);
+
+				free_bigint_without_reset(product);
+				free_bigint_without_reset(difference);
+			}
+
+			free_bigint_without_reset(divmod.quotient);
+			free_bigint_without_reset(divmod.remainder);
+		}
+
+		BigIntC* temp = current_a;
+		current_a = next_a;
+		next_a = temp;
+
+		temp = current_b;
+		current_b = next_b;
+		next_b = temp;
+
+		temp = factor_a;
+		factor_a = next_factor_a;
+		next_factor_a = temp;
+
+		temp = factor_b;
+		factor_b = next_factor_b;
+		next_factor_b = temp;
+	}
+
+	if(result.numbers == NULL) {
+		result = bigint_copy(*current_a);
+	}
+
+	if(factor != NULL) {
+		*factor = bigint_copy(*factor_a);
+	}
+
+	free(scratch);
+
+	return result;
+}
+
+// half gcd
+
+// from this number count on, the gcd uses the half gcd, below that the lehmer steps are faster
+#ifndef BIGINT_GCD_HALF_THRESHOLD
+#define BIGINT_GCD_HALF_THRESHOLD 1024
+#endif
+
+// the same for the gcd with a cofactor, the lehmer steps need to combine the cofactors after
+// every step, the half gcd only once per reduction, so it is faster much earlier
+#ifndef BIGINT_GCDEXT_HALF_THRESHOLD
+#define BIGINT_GCDEXT_HALF_THRESHOLD 256
+#endif
+
+// up to this number count, the half gcd uses the lehmer steps instead of recursing
+#ifndef BIGINT_HALF_GCD_BASE_THRESHOLD
+#define BIGINT_HALF_GCD_BASE_THRESHOLD 200
+#endif
+
+// the signed matrix of a reduction, (a', b') = matrix * (a, b), its determinant is +-1, so a' and
+// b' have the same gcd as a and b, its inverse has the same entries without signs
+typedef struct {
+	BigIntC entries[2][2];
+} HalfGcdMatrix;
+
+NODISCARD static HalfGcdMatrix bigint_helper_half_gcd_identity(void) {
+
+	HalfGcdMatrix matrix;
+
+	for(size_t i = 0; i < 2; ++i) {
+		for(size_t j = 0; j < 2; ++j) {
+			matrix.entries[i][j] = bigint_from_unsigned_number(i == j ? 1 : 0);
+		}
+	}
+
+	return matrix;
+}
+
+static void free_half_gcd_matrix(HalfGcdMatrix matrix) {
+
+	for(size_t i = 0; i < 2; ++i) {
+		for(size_t j = 0; j < 2; ++j) {
+			free_bigint_without_reset(matrix.entries[i][j]);
+		}
+	}
+}
+
+// factor_x * x + factor_y * y, the products use the fast multiplications
+NODISCARD static BigIntC bigint_helper_linear_combination(BigIntC factor_x, BigIntC big_int_x,
+                                                          BigIntC factor_y, BigIntC big_int_y) {
+
+	BigIntC product_x = bigint_mul_bigint(factor_x, big_int_x);
+	BigIntC product_y = bigint_mul_bigint(factor_y, big_int_y);
+
+	BigIntC result = bigint_add_bigint(product_x, product_y);
+
+	free_bigint_without_reset(product_x);
+	free_bigint_without_reset(product_y);
+
+	return result;
+}
+
+// (a, b) = matrix * (a, b)
+static void bigint_helper_half_gcd_apply(BigIntC* big_int_a, BigIntC* big_int_b,
+                                         const HalfGcdMatrix* matrix) {
+
+	BigIntC new_a = bigint_helper_linear_combination(matrix->entries[0][0], *big_int_a,
+	                                                 matrix->entries[0][1], *big_int_b);
+	BigIntC new_b = bigint_helper_linear_combination(matrix->entries[1][0], *big_int_a,
+	                                                 matrix->entries[1][1], *big_int_b);
+
+	bigint_helper_replace(big_int_a, new_a);
+	bigint_helper_replace(big_int_b, new_b);
+}
+
+// matrix = other * matrix, other gets freed
+static void bigint_helper_half_gcd_compose(HalfGcdMatrix* matrix, HalfGcdMatrix other) {
+
+	HalfGcdMatrix result;
+
+	for(size_t i = 0; i < 2; ++i) {
+		for(size_t j = 0; j < 2; ++j) {
+			result.entries[i][j] =
+			    bigint_helper_linear_combination(other.entries[i][0], matrix->entries[0][j],
+			                                     other.entries[i][1], matrix->entries[1][j]);
+		}
+	}
+
+	free_half_gcd_matrix(*matrix);
+	free_half_gcd_matrix(other);
+
+	*matrix = result;
+}
+
+// swaps a and b and with them the rows of the matrix
+static void bigint_helper_half_gcd_swap(BigIntC* big_int_a, BigIntC* big_int_b,
+                                        HalfGcdMatrix* matrix) {
+
+	const BigIntC temp = *big_int_a;
+	*big_int_a = *big_int_b;
+	*big_int_b = temp;
+
+	for(size_t j = 0; j < 2; ++j) {
+		const BigIntC entry = matrix->entries[0][j];
+		matrix->entries[0][j] = matrix->entries[1][j];
+		matrix->entries[1][j] = entry;
+	}
+}
+
+// one euclidean step (a, b) -> (b, a mod b), that is only taken, if a mod b has more than s bits
+NODISCARD static bool bigint_helper_half_gcd_division_step(BigIntC* big_int_a, BigIntC* big_int_b,
+                                                           HalfGcdMatrix* matrix, size_t s) {
+
+	BigIntDivModC divmod = bigint_divmod_both_positive(*big_int_a, *big_int_b);
+
+	if(bigint_helper_bit_length(divmod.remainder) <= s) {
+		free_bigint_without_reset(divmod.quotient);
+		free_bigint_without_reset(divmod.remainder);
+		return false;
+	}
+
+	bigint_helper_replace(big_int_a, *big_int_b);
+	*big_int_b = divmod.remainder;
+
+	// the new second row is first row - quotient * second row
+	for(size_t j = 0; j < 2; ++j) {
+		BigIntC product = bigint_mul_bigint(divmod.quotient, matrix->entries[1][j]);
+		BigIntC difference = bigint_sub_bigint(matrix->entries[0][j], product);
+
+		free_bigint_without_reset(product);
+		free_bigint_without_reset(matrix->entries[0][j]);
+
+		matrix->entries[0][j] = matrix->entries[1][j];
+		matrix->entries[1][j] = difference;
+	}
+
+	free_bigint_without_reset(divmod.quotient);
+
+	return true;
+}
+
+// x * factor_x - y * factor_y as a new big int
+NODISCARD static BigIntC bigint_helper_gcd_combine_new(BigIntC big_int_x, uint64_t factor_x,
+                                                       BigIntC big_int_y, uint64_t factor_y) {
+
+	BigIntC result = { .positive = true,
+		               .numbers = NULL,
+		               .number_count = (big_int_x.number_count > big_int_y.number_count
+		                                    ? big_int_x.number_count
+		                                    : big_int_y.number_count) +
+		                               2 };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	bigint_helper_gcd_combine(&result, big_int_x, factor_x, big_int_y, factor_y);
+
+	return result;
+}
+
+// the reduction of small numbers with the lehmer steps, every remainder has to stay at least 2^s
+static void bigint_helper_half_gcd_base(BigIntC* big_int_a, BigIntC* big_int_b,
+                                        HalfGcdMatrix* matrix, size_t s) {
+
+	while(bigint_helper_bit_length(*big_int_b) > s) {
+
+		const bool exact = big_int_a->number_count <= 2;
+		const size_t bits = bigint_helper_bit_length(*big_int_a);
+		const size_t index = exact ? 0 : bits - (2 * NUMBER_BIT_COUNT);
+
+		// the remainders are at least 2^index * limit, a has more than s bits, so this fits
+		DoubleNumber limit = { .high = 0, .low = 1 };
+
+		if(s >= index) {
+			limit = helper_double_shift_left(limit, s - index);
+		}
+
+		const GcdMatrix steps =
+		    bigint_helper_gcd_matrix(helper_double_at_bit(*big_int_a, index),
+		                             helper_double_at_bit(*big_int_b, index), exact, limit);
+
+		if(steps.steps == 0) {
+			if(!bigint_helper_half_gcd_division_step(big_int_a, big_int_b, matrix, s)) {
+				break;
+			}
+
+			continue;
+		}
+
+		BigIntC new_a =
+		    bigint_helper_gcd_combine_new(*big_int_a, steps.first_a, *big_int_b, steps.first_b);
+		BigIntC new_b =
+		    bigint_helper_gcd_combine_new(*big_int_a, steps.second_a, *big_int_b, steps.second_b);
+
+		for(size_t j = 0; j < 2; ++j) {
+			BigIntC first = bigint_helper_gcd_combine_new(
+			    matrix->entries[0][j], steps.first_a, matrix->entries[1][j], steps.first_b);
+			BigIntC second = bigint_helper_gcd_combine_new(
+			    matrix->entries[0][j], steps.second_a, matrix->entries[1][j], steps.second_b);
+
+			// the numbers are made positive, so their rows get the sign of the differences
+			if(!new_a.positive) {
+				bigint_negate(&first);
+			}
+
+			if(!new_b.positive) {
+				bigint_negate(&second);
+			}
+
+			bigint_helper_replace(&(matrix->entries[0][j]), first);
+			bigint_helper_replace(&(matrix->entries[1][j]), second);
+		}
+
+		new_a.positive = true;
+		new_b.positive = true;
+
+		bigint_helper_replace(big_int_a, new_a);
+		bigint_helper_replace(big_int_b, new_b);
+	}
+}
+
+NODISCARD static bool bigint_helper_half_gcd(BigIntC* big_int_a, BigIntC* big_int_b,
+                                             HalfGcdMatrix* matrix);
+
+// reduces a >= b with the half gcd of their parts above bit shift, the matrix of those is
+// multiplied into matrix
+static void // NOLINTNEXTLINE(misc-no-recursion)
+bigint_helper_half_gcd_top(BigIntC* big_int_a, BigIntC* big_int_b, HalfGcdMatrix* matrix,
+                           size_t shift) {
+
+	BigIntC top_a = bigint_helper_shift_right(*big_int_a, shift);
+	BigIntC top_b = bigint_helper_shift_right(*big_int_b, shift);
+
+	HalfGcdMatrix top_matrix = bigint_helper_half_gcd_identity();
+
+	const bool reduced = bigint_helper_half_gcd(&top_a, &top_b, &top_matrix);
+
+	free_bigint_without_reset(top_a);
+	free_bigint_without_reset(top_b);
+
+	if(!reduced) {
+		free_half_gcd_matrix(top_matrix);
+		return;
+	}
+
+	bigint_helper_half_gcd_apply(big_int_a, big_int_b, &top_matrix);
+
+	if(bigint_compare_bigint(*big_int_a, *big_int_b) < 0) {
+		bigint_helper_half_gcd_swap(big_int_a, big_int_b, &top_matrix);
+	}
+
+	bigint_helper_half_gcd_compose(matrix, top_matrix);
+}
+
+// the half gcd (Schönhage, in the form of Möller, 2008), reduces a >= b > 0 with n bits by steps of
+// the euclidean algorithm, as long as both stay at least 2^s with s = n / 2 + 1, matrix has to be
+// the identity and gets the reduction, returns false, if nothing was reduced,
+// the reduction of the top n' bits of two numbers to at least 2^s' with s' = n' / 2 + 1 has
+// entries less than 2^(n' - s'), so the bits below the cut at p change the reduced full numbers by
+// less than 2^(p + n' - s'), that is at most 2^s, if the cut is chosen right, so the reduction of
+// the top bits is also a reduction of the full numbers
+NODISCARD static bool // NOLINTNEXTLINE(misc-no-recursion)
+bigint_helper_half_gcd(BigIntC* big_int_a, BigIntC* big_int_b, HalfGcdMatrix* matrix) {
+
+	const size_t bits = bigint_helper_bit_length(*big_int_a);
+	const size_t s = (bits / 2) + 1;
+
+	if(bigint_helper_bit_length(*big_int_b) <= s) {
+		return false;
+	}
+
+	if(big_int_a->number_count <= BIGINT_HALF_GCD_BASE_THRESHOLD) {
+		bigint_helper_half_gcd_base(big_int_a, big_int_b, matrix, s);
+		return true;
+	}
+
+	{ // 1. the reduction of the top half, n' = n - n / 2 and s' = n' / 2 + 1
+
+		bigint_helper_half_gcd_top(big_int_a, big_int_b, matrix, bits / 2);
+	}
+
+	{ // 2. division steps, until a has at most 3/4 of the bits
+
+		while(bigint_helper_bit_length(*big_int_a) > (3 * bits) / 4) {
+			if(!bigint_helper_half_gcd_division_step(big_int_a, big_int_b, matrix, s)) {
+				return true;
+			}
+		}
+	}
+
+	{ // 3. the reduction of the top part with n' = 2 * (bits of a - s - 1), so that s' + s is the
+		// bits of a, that is about n / 2 again
+
+		const size_t current_bits = bigint_helper_bit_length(*big_int_a);
+
+		bigint_helper_half_gcd_top(big_int_a, big_int_b, matrix, (2 * s) + 2 - current_bits);
+	}
+
+	{ // 4. the last few division steps
+
+		while(bigint_helper_half_gcd_division_step(big_int_a, big_int_b, matrix, s)) {
+		}
+	}
+
+	return true;
+}
+
+// the gcd of numbers with at least threshold numbers, the half gcd reduces them to half of their
+// size, followed by a division step, that also makes progress, if the half gcd can't reduce them,
+// the rest is done by the lehmer steps, the cofactors of |big_int1| mod |big_int2| are reduced
+// with the same matrices
+NODISCARD static BigIntC bigint_helper_gcd_half(BigIntC big_int1, BigIntC big_int2,
+                                                BigIntC* factor, size_t threshold) {
+
+	big_int1.positive = true;
+	big_int2.positive = true;
+
+	BigIntC current_a = bigint_copy(big_int1);
+	BigIntC current_b = bigint_copy(big_int2);
+	BigIntC factor_a = bigint_from_unsigned_number(bigint_helper_is_zero(big_int1) ? 0 : 1);
+	BigIntC factor_b = bigint_from_unsigned_number(0);
+
+	if(bigint_compare_bigint(current_a, current_b) < 0) {
+		BigIntC temp = current_a;
+		current_a = current_b;
+		current_b = temp;
+
+		temp = factor_a;
+		factor_a = factor_b;
+		factor_b = temp;
+	}
+
+	while(!bigint_helper_is_zero(current_b) &&
+	      current_a.number_count >= threshold) {
+
+		HalfGcdMatrix matrix = bigint_helper_half_gcd_identity();
+
+		if(bigint_helper_half_gcd(&current_a, &current_b, &matrix) && factor != NULL) {
+			bigint_helper_half_gcd_apply(&factor_a, &factor_b, &matrix);
+		}
+
+		free_half_gcd_matrix(matrix);
+
+		if(!bigint_helper_is_zero(current_b)) {
+			BigIntDivModC divmod = bigint_divmod_both_positive(current_a, current_b);
+
+			bigint_helper_replace(&current_a, current_b);
+			current_b = divmod.remainder;
+
+			if(factor != NULL) {
+				BigIntC product = bigint_mul_bigint(divmod.quotient, factor_b);
+				BigIntC difference = bigint_sub_bigint(factor_a, product);
+
+				bigint_helper_replace(&factor_a, factor_b);
+				factor_b = difference;
+
+				free_bigint_without_reset(product);
+			}
+
+			free_bigint_without_reset(divmod.quotient);
+		}
+	}
+
+	BigIntC rest_factor = { .positive = true, .numbers = NULL, .number_count = 0 };
+
+	BigIntC result =
+	    bigint_helper_gcd_lehmer(current_a, current_b, factor == NULL ? NULL : &rest_factor);
+
+	if(factor != NULL) {
+		// gcd = rest_factor * a + other * b, so gcd = rest_factor * factor_a + other * factor_b
+		// times |big_int1| mod |big_int2|
+		BigIntC other = bigint_from_unsigned_number(0);
+
+		if(!bigint_helper_is_zero(current_b)) {
+			BigIntC product = bigint_mul_bigint(rest_factor, current_a);
+			BigIntC difference = bigint_sub_bigint(result, product);
+
+			bigint_helper_replace(&other, bigint_divexact(difference, current_b));
+
+			free_bigint_without_reset(product);
+			free_bigint_without_reset(difference);
+		}
+
+		*factor = bigint_helper_linear_combination(rest_factor, factor_a, other, factor_b);
+
+		free_bigint_without_reset(other);
+
+		// the factor only matters mod |big_int2| / gcd, the one with the smallest magnitude is taken
+		if(!bigint_helper_is_zero(big_int2)) {
+			BigIntC period = bigint_divexact(big_int2, result);
+
+			bigint_helper_replace(factor, bigint_mod_floor(*factor, period));
+
+			BigIntC doubled = bigint_add_bigint(*factor, *factor);
+
+			if(bigint_compare_bigint(doubled, period) > 0) {
+				bigint_helper_replace(factor, bigint_sub_bigint(*factor, period));
+			}
+
+			free_bigint_without_reset(doubled);
+			free_bigint_without_reset(period);
+		}
+	}
+
+	free_bigint_without_reset(rest_factor);
+	free_bigint_without_reset(current_a);
+	free_bigint_without_reset(current_b);
+	free_bigint_without_reset(factor_a);
+	free_bigint_without_reset(factor_b);
+
+	return result;
+}
+
+// returns gcd(|big_int1|, |big_int2|), if factor isn't NULL, it gets a s with
+// s * |big_int1| = gcd mod |big_int2|
+NODISCARD static BigIntC bigint_helper_gcd(BigIntC big_int1, BigIntC big_int2, BigIntC* factor) {
+
+	const size_t threshold =
+	    factor == NULL ? BIGINT_GCD_HALF_THRESHOLD : BIGINT_GCDEXT_HALF_THRESHOLD;
+
+	if(big_int1.number_count >= threshold || big_int2.number_count >= threshold) {
+		return bigint_helper_gcd_half(big_int1, big_int2, factor, threshold);
+	}
+
+	return bigint_helper_gcd_lehmer(big_int1, big_int2, factor);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_gcd(BigIntC big_int1, BigIntC big_int2) {
+
+	return bigint_helper_gcd(big_int1, big_int2, NULL);
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntGcdExtC bigint_gcdext(BigIntC big_int1, BigIntC big_int2) {
+
+	BigIntGcdExtC result = { .gcd = { .positive = true, .numbers = NULL, .number_count = 0 },
+		                     .factor1 = { .positive = true, .numbers = NULL, .number_count = 0 },
+		                     .factor2 = { .positive = true, .numbers = NULL, .number_count = 0 } };
+
+	result.gcd = bigint_helper_gcd(big_int1, big_int2, &(result.factor1));
+
+	{ // factor2 = (gcd - factor1 * |big_int1|) / |big_int2|, that division is exact
+
+		BigIntC magnitude1 = big_int1;
+		magnitude1.positive = true;
+
+		BigIntC magnitude2 = big_int2;
+		magnitude2.positive = true;
+
+		if(bigint_helper_is_zero(big_int2)) {
+			result.factor2 = bigint_from_unsigned_number(0);
+		} else {
+			BigIntC product = bigint_mul_bigint(result.factor1, magnitude1);
+			BigIntC difference = bigint_sub_bigint(result.gcd, product);
+
+			result.factor2 = bigint_divexact(difference, magnitude2);
+
+			free_bigint_without_reset(product);
+			free_bigint_without_reset(difference);
+		}
+	}
+
+	// the factors of the magnitudes get the signs of the numbers
+	if(!big_int1.positive) {
+		bigint_negate(&(result.factor1));
+	}
+
+	if(!big_int2.positive) {
+		bigint_negate(&(result.factor2));
+	}
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED bool bigint_invert(BigIntC* result, BigIntC big_int,
+                                                   BigIntC modulus) {
+
+	if(bigint_helper_is_zero(modulus)) {
+		UNREACHABLE_WITH_MSG("division by zero");
+	}
+
+	modulus.positive = true;
+
+	BigIntC factor = { .positive = true, .numbers = NULL, .number_count = 0 };
+	BigIntC gcd = bigint_helper_gcd(big_int, modulus, &factor);
+
+	const bool invertible = bigint_eq_u64(gcd, 1);
+
+	if(invertible) {
+		// factor * |big_int| = 1, so the inverse of a negative number is -factor
+		if(!big_int.positive) {
+			bigint_negate(&factor);
+		}
+
+		*result = bigint_mod_floor(factor, modulus);
+	}
+
+	free_bigint_without_reset(gcd);
+	free_bigint_without_reset(factor);
+
+	return invertible;
+}
+
+// roots
+
+// returns |big_int| mod 2^amount
+NODISCARD static BigIntC bigint_helper_low_bits(BigIntC big_int, size_t amount) {
+
+	const size_t count =
+	    helper_min(big_int.number_count, helper_ceil_div(amount, NUMBER_BIT_COUNT));
+
+	if(count == 0) {
+		return bigint_helper_zero();
+	}
+
+	BigIntC result = { .positive = true, .numbers = NULL, .number_count = count };
+
+	bigint_helper_realloc_to_new_size(&result);
+
+	bigint_limbs_copy(result.numbers, big_int.numbers, count);
+
+	if(count * NUMBER_BIT_COUNT > amount) {
+		result.numbers[count - 1] &= (U64(1) << (amount % NUMBER_BIT_COUNT)) - 1;
+	}
+
+	bigint_helper_remove_leading_zeroes(&result);
+
+	return result;
+}
+
+// floor(sqrt(number)) and the remainder, one bit of the root per two bits of the number
+NODISCARD static uint64_t helper_sqrtrem_number(uint64_t number, uint64_t* remainder) {
+
+	uint64_t root = U64(0);
+	uint64_t rest = U64(0);
+
+	for(size_t i = NUMBER_BIT_COUNT / 2; i != 0; --i) {
+		rest = (rest << 2) | ((number >> (2 * (i - 1))) & 0x03);
+		root = root << 1;
+
+		// (2 * root + 1)^2 - (2 * root)^2 = 2 * (2 * root) + 1
+		const uint64_t difference = (root << 1) | 1;
+
+		if(rest >= difference) {
+			rest -= difference;
+			root = root | 1;
+		}
+	}
+
+	*remainder = rest;
+	return root;
+}
+
+// the karatsuba square root (Zimmermann, 1999) of 2^(2 * half_bits - 2) <= big_int <
+// 2^(2 * half_bits), with big_int = high * 2^(2 * h) + middle * 2^h + low, the root of high is
+// the top half of the root, the bottom half is one division of its remainder by two times that
+// root, which is at most one too big, so the remainder is corrected at most once
+NODISCARD static BigIntRootRemC // NOLINTNEXTLINE(misc-no-recursion)
+bigint_helper_sqrtrem(BigIntC big_int, size_t half_bits) {
+
+	if(half_bits <= NUMBER_BIT_COUNT / 2) {
+		uint64_t remainder = U64(0);
+		const uint64_t root = helper_sqrtrem_number(big_int.numbers[0], &remainder);
+
+		const BigIntRootRemC result = { .root = bigint_from_unsigned_number(root),
+			                            .remainder = bigint_from_unsigned_number(remainder) };
+		return result;
+	}
+
+	const size_t low_bits = half_bits / 2;
+
+	BigIntRootRemC result = { .root = { .positive = true, .numbers = NULL, .number_count = 0 },
+		                      .remainder = { .positive = true,
+		                                     .numbers = NULL,
+		                                     .number_count = 0 } };
+
+	{ // 1. the root of the top half, high has at least as many bits as 2^(2 * h) / 4
+
+		BigIntC high = bigint_helper_shift_right(big_int, 2 * low_bits);
+
+		result = bigint_helper_sqrtrem(high, half_bits - low_bits);
+
+		free_bigint_without_reset(high);
+	}
+
+	{ // 2. (quotient, rest) = divmod(remainder * 2^h + middle, 2 * root)
+
+		BigIntC both_low = bigint_helper_low_bits(big_int, 2 * low_bits);
+		BigIntC middle = bigint_helper_shift_right(both_low, low_bits);
+		BigIntC low = bigint_helper_low_bits(big_int, low_bits);
+
+		BigIntC shifted_remainder = bigint_helper_shift_left(result.remainder, low_bits);
+		BigIntC numerator = bigint_add_bigint(shifted_remainder, middle);
+		BigIntC divisor = bigint_helper_shift_left(result.root, 1);
+
+		BigIntDivModC divmod = bigint_divmod_both_positive(numerator, divisor);
+
+		// 3. root = root * 2^h + quotient, remainder = rest * 2^h + low - quotient^2
+
+		bigint_helper_replace(&(result.root), bigint_helper_shift_left(result.root, low_bits));
+		bigint_helper_replace(&(result.root), bigint_add_bigint(result.root, divmod.quotient));
+
+		BigIntC shifted_rest = bigint_helper_shift_left(divmod.remainder, low_bits);
+		BigIntC square = bigint_sqr(divmod.quotient);
+
+		bigint_helper_replace(&(result.remainder), bigint_add_bigint(shifted_rest, low));
+		bigint_helper_replace(&(result.remainder), bigint_sub_bigint(result.remainder, square));
+
+		free_bigint_without_reset(both_low);
+		free_bigint_without_reset(middle);
+		free_bigint_without_reset(low);
+		free_bigint_without_reset(shifted_remainder);
+		free_bigint_without_reset(numerator);
+		free_bigint_without_reset(divisor);
+		free_bigint_without_reset(divmod.quotient);
+		free_bigint_without_reset(divmod.remainder);
+		free_bigint_without_reset(shifted_rest);
+		free_bigint_without_reset(square);
+	}
+
+	{ // 4. if the quotient was one too big, (root - 1)^2 = root^2 - 2 * root + 1
+
+		if(!result.remainder.positive) {
+			BigIntC doubled = bigint_helper_shift_left(result.root, 1);
+
+			bigint_helper_replace(&(result.remainder), bigint_add_bigint(result.remainder, doubled));
+			bigint_helper_replace(&(result.remainder), bigint_sub_u64(result.remainder, 1));
+			bigint_helper_replace(&(result.root), bigint_sub_u64(result.root, 1));
+
+			free_bigint_without_reset(doubled);
+		}
+	}
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntRootRemC bigint_sqrtrem(BigIntC big_int) {
+
+	if(!big_int.positive) {
+		UNREACHABLE_WITH_MSG("the square root of a negative number");
+	}
+
+	if(bigint_helper_is_zero(big_int)) {
+		const BigIntRootRemC result = { .root = bigint_helper_zero(),
+			                            .remainder = bigint_helper_zero() };
+		return result;
+	}
+
+	return bigint_helper_sqrtrem(big_int, helper_ceil_div(bigint_helper_bit_length(big_int), 2));
+}
+
+// extra bits of the root of the top bits, so that one newton step from it is almost always
+// already the root and the exact root doesn't need a second division
+#define ROOT_NEWTON_GUARD_BITS 8
+
+// floor(big_int^(1 / degree)) for big_int >= 0, the root of the top bits has half of the bits
+// of the root, newton's method from above that start doubles the precision in every step, the
+// steps never go below the root, so if exact is false, one step is enough for the start of the
+// next level, otherwise they continue until the power isn't bigger than big_int, the recursion
+// ends at roots of up to 64 bits, which are found bit by bit
+NODISCARD static BigIntC // NOLINTNEXTLINE(misc-no-recursion)
+bigint_helper_root(BigIntC big_int, uint64_t degree, bool exact) {
+
+	const size_t root_bits = helper_ceil_div(bigint_helper_bit_length(big_int), degree);
+
+	if(root_bits <= NUMBER_BIT_COUNT) {
+		// 1. every bit of the root from the top is kept, if the power isn't bigger than big_int
+		uint64_t root = U64(0);
+
+		for(size_t i = root_bits; i != 0; --i) {
+			const uint64_t candidate = root | (U64(1) << (i - 1));
+
+			BigIntC candidate_big_int = bigint_from_unsigned_number(candidate);
+			BigIntC power = bigint_pow_u64(candidate_big_int, degree);
+
+			if(bigint_compare_bigint(power, big_int) <= 0) {
+				root = candidate;
+			}
+
+			free_bigint_without_reset(candidate_big_int);
+			free_bigint_without_reset(power);
+		}
+
+		return bigint_from_unsigned_number(root);
+	}
+
+	const size_t low_bits = (root_bits / 2) - ROOT_NEWTON_GUARD_BITS;
+
+	BigIntC current = { .positive = true, .numbers = NULL, .number_count = 0 };
+
+	{ // 2. (root of the top bits + 1) * 2^low_bits is at least the root
+
+		BigIntC high = bigint_helper_shift_right(big_int, low_bits * degree);
+		BigIntC high_root = bigint_helper_root(high, degree, false);
+
+		bigint_helper_replace(&high_root, bigint_add_u64(high_root, 1));
+
+		current = bigint_helper_shift_left(high_root, low_bits);
+
+		free_bigint_without_reset(high);
+		free_bigint_without_reset(high_root);
+	}
+
+	{ // 3. next = ((degree - 1) * current + big_int / current^(degree - 1)) / degree
+
+		const BigIntDivisorU64 divisor = bigint_divisor_u64_from_number(degree);
+
+		while(true) {
+			BigIntC power = bigint_pow_u64(current, degree - 1);
+
+			if(exact) {
+				BigIntC full_power = bigint_mul_bigint(power, current);
+				const bool done = bigint_compare_bigint(full_power, big_int) <= 0;
+
+				free_bigint_without_reset(full_power);
+
+				if(done) {
+					free_bigint_without_reset(power);
+					break;
+				}
+			}
+
+			BigIntDivModC divmod = bigint_divmod_both_positive(big_int, power);
+			BigIntC product = bigint_mul_u64(current, degree - 1);
+			BigIntC sum = bigint_add_bigint(product, divmod.quotient);
+			BigIntDivModU64C next = bigint_divmod_u64_pre(sum, divisor);
+
+			free_bigint_without_reset(power);
+			free_bigint_without_reset(divmod.quotient);
+			free_bigint_without_reset(divmod.remainder);
+			free_bigint_without_reset(product);
+			free_bigint_without_reset(sum);
+
+			bigint_helper_replace(&current, next.quotient);
+
+			if(!exact) {
+				break;
+			}
+		}
+	}
+
+	return current;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntRootRemC bigint_rootrem(BigIntC big_int, uint64_t degree) {
+
+	if(degree == 0) {
+		UNREACHABLE_WITH_MSG("the degree of a root can't be 0");
+	}
+
+	if(!big_int.positive && (degree & 0x01) == 0) {
+		UNREACHABLE_WITH_MSG("an even root of a negative number");
+	}
+
+	if(degree == 2) {
+		return bigint_sqrtrem(big_int);
+	}
+
+	BigIntC magnitude = big_int;
+	magnitude.positive = true;
+
+	BigIntRootRemC result = { .root = degree == 1 ? bigint_copy(magnitude)
+		                                          : bigint_helper_root(magnitude, degree, true),
+		                      .remainder = { .positive = true,
+		                                     .numbers = NULL,
+		                                     .number_count = 0 } };
+
+	// an odd root of a negative number is negative, so the remainder has the sign of big_int
+	if(!big_int.positive) {
+		bigint_negate(&(result.root));
+	}
+
+	BigIntC power = bigint_pow_u64(result.root, degree);
+
+	result.remainder = bigint_sub_bigint(big_int, power);
+
+	free_bigint_without_reset(power);
+
+	return result;
+}
+
+// primes
+
+// the odd primes below this bound divide big_int in bigint_is_probable_prime, before any
+// exponentiation, their product has about 1.44 * bound bits
+#ifndef BIGINT_PRIME_TRIAL_BOUND
+#define BIGINT_PRIME_TRIAL_BOUND 1024
+#endif
+
+// the odd primes below this bound sieve the candidates of bigint_next_prime
+#ifndef BIGINT_PRIME_SIEVE_BOUND
+#define BIGINT_PRIME_SIEVE_BOUND 65536
+#endif
+
+// the amount of odd candidates, that bigint_next_prime sieves at once
+#ifndef BIGINT_PRIME_SIEVE_WINDOW
+#define BIGINT_PRIME_SIEVE_WINDOW 4096
+#endif
+
+// the odd primes below a bound, grouped into products, that fit into one number, so that the
+// residues modulo all primes of a group only take one division of the big number
+typedef struct {
+	uint64_t* primes;
+	size_t count;
+	uint64_t* group_products;
+	uint64_t* group_ends;
+	size_t group_count;
+} SmallPrimes;
+
+// the sieve of eratosthenes up to the bound
+NODISCARD static SmallPrimes helper_small_primes_below(uint64_t bound) {
+
+	bool* const composite = (bool*)malloc(sizeof(bool) * bound);
+
+	if(composite == NULL) { // GCOVR_EXCL_BR_LINE (OOM)
+		UNREACHABLE_WITH_MSG( // GCOVR_EXCL_LINE (OOM content)
+		    "malloc failed, no error handling implemented here");
+	} // GCOVR_EXCL_LINE (OOM content)
+
+	memset(composite, 0, sizeof(bool) * bound);
+
+	size_t count = 0;
+
+	for(uint64_t i = 3; i < bound; i += 2) {
+		if(composite[i]) {
+			continue;
+		}
+
+		++count;
+
+		for(uint64_t j = i * i; j < bound; j += 2 * i) {
+			composite[j] = true;
+		}
+	}
+
+	// every group has at least one prime, so there are at most count groups
+	uint64_t* const memory = bigint_helper_allocate_scratch(3 * count);
+
+	SmallPrimes result = { .primes = memory,
+		                   .count = 0,
+		                   .group_products = memory + count,
+		                   .group_ends = memory + (2 * count),
+		                   .group_count = 0 };
+
+	uint64_t product = U64(1);
+
+	for(uint64_t i = 3; i < bound; i += 2) {
+		if(composite[i]) {
+			continue;
+		}
+
+		if(product > UINT64_MAX / i) {
+			result.group_products[result.group_count] = product;
+			result.group_ends[result.group_count] = result.count;
+			++result.group_count;
+			product = U64(1);
+		}
+
+		product *= i;
+		result.primes[result.count] = i;
+		++result.count;
+	}
+
+	if(result.count != 0) {
+		result.group_products[result.group_count] = product;
+		result.group_ends[result.group_count] = result.count;
+		++result.group_count;
+	}
+
+	free(composite);
+
+	return result;
+}
+
+static void free_small_primes(SmallPrimes* primes) {
+	free(primes->primes);
+	primes->primes = NULL;
+}
+
+// |big_int| mod every prime, with one division per group, if reduce is set and big_int has more
+// numbers than the product of all primes, it is first reduced with one division by that product,
+// so the divisions by the groups only get that many numbers
+static void bigint_helper_small_prime_residues(uint64_t* residues, BigIntC big_int,
+                                               const SmallPrimes* primes, bool reduce) {
+
+	BigIntC reduced = big_int;
+	reduced.positive = true;
+
+	// the product has at most one number per group, so it is smaller than such a big_int
+	const bool reduced_by_product = reduce && big_int.number_count > primes->group_count;
+
+	if(reduced_by_product) {
+		BigIntC product = bigint_from_unsigned_number(U64(1));
+
+		for(size_t i = 0; i < primes->group_count; ++i) {
+			bigint_helper_replace(&product, bigint_mul_u64(product, primes->group_products[i]));
+		}
+
+		reduced = bigint_mod(reduced, product);
+
+		free_bigint_without_reset(product);
+	}
+
+	size_t start = 0;
+
+	for(size_t i = 0; i < primes->group_count; ++i) {
+		const uint64_t residue = bigint_mod_u64_pre(
+		    reduced, bigint_divisor_u64_from_number(primes->group_products[i]));
+
+		for(size_t j = start; j < primes->group_ends[i]; ++j) {
+			residues[j] = residue % primes->primes[j];
+		}
+
+		start = primes->group_ends[i];
+	}
+
+	if(reduced_by_product) {
+		free_bigint_without_reset(reduced);
+	}
+}
+
+// the jacobi symbol (value / number) for an odd number, with the quadratic reciprocity
+NODISCARD static int8_t helper_jacobi_number(uint64_t value, uint64_t number) {
+
+	int8_t result = 1;
+
+	value = value % number;
+
+	while(value != 0) {
+		const size_t zeros = helper_count_trailing_zeros(value);
+		value = value >> zeros;
+
+		// (2 / number) is -1 for number = 3 or 5 mod 8
+		if((zeros & 0x01) != 0 && ((number & 0x07) == 3 || (number & 0x07) == 5)) {
+			result = (int8_t)-result;
+		}
+
+		if((value & 0x03) == 3 && (number & 0x03) == 3) {
+			result = (int8_t)-result;
+		}
+
+		const uint64_t temp = number % value;
+		number = value;
+		value = temp;
+	}
+
+	return number == 1 ? result : 0;
+}
+
+// the jacobi symbol (value / big_int) for a small odd value and an odd big_int, the reciprocity
+// turns it into (big_int mod |value| / |value|)
+NODISCARD static int8_t bigint_helper_jacobi_small(int64_t value, BigIntC big_int) {
+
+	const uint64_t magnitude = helper_unsigned_abs(value);
+	const uint64_t big_int_mod_4 = big_int.numbers[0] & 0x03;
+
+	int8_t result = helper_jacobi_number(
+	    bigint_mod_u64_pre(big_int, bigint_divisor_u64_from_number(magnitude)), magnitude);
+
+	if((magnitude & 0x03) == 3 && big_int_mod_4 == 3) {
+		result = (int8_t)-result;
+	}
+
+	// (-1 / big_int) is -1 for big_int = 3 mod 4
+	if(value < 0 && big_int_mod_4 == 3) {
+		result = (int8_t)-result;
+	}
+
+	return result;
+}
+
+// the strong probable prime test (miller rabin) of the odd big_int to the base, with
+// big_int - 1 = odd * 2^twos
+NODISCARD static bool bigint_helper_strong_probable_prime(BigIntC big_int, BigIntC odd,
+                                                          size_t twos, BigIntC base,
+                                                          BigIntBarrettCtx* ctx) {
+
+	const BigIntC minus_one = bigint_sub_u64(big_int, U64(1));
+
+	BigIntC current = bigint_powm(base, odd, big_int);
+
+	bool result = bigint_eq_u64(current, U64(1)) || bigint_eq_bigint(current, minus_one);
+
+	for(size_t i = 1; i < twos && !result; ++i) {
+		bigint_helper_replace(&current, bigint_mulmod_barrett(current, current, ctx));
+
+		if(bigint_eq_u64(current, U64(1))) {
+			break;
+		}
+
+		result = bigint_eq_bigint(current, minus_one);
+	}
+
+	free_bigint_without_reset(current);
+	free_bigint_without_reset(minus_one);
+
+	return result;
+}
+
+// big_int / 2 mod the odd modulus of the context, for 0 <= big_int < 2 * modulus
+NODISCARD static BigIntC bigint_helper_half_mod(BigIntC big_int, BigIntBarrettCtx* ctx) {
+
+	BigIntC sum = (big_int.numbers[0] & 0x01) == 0 ? bigint_copy(big_int)
+	                                                : bigint_add_bigint(big_int, ctx->modulus);
+
+	BigIntC result = bigint_helper_shift_right(sum, 1);
+
+	free_bigint_without_reset(sum);
+
+	if(bigint_compare_bigint(result, ctx->modulus) >= 0) {
+		bigint_helper_replace(&result, bigint_sub_bigint(result, ctx->modulus));
+	}
+
+	return result;
+}
+
+// (left^2 - 2 * right) mod the modulus of the context, the doubling step of the lucas sequence V
+NODISCARD static BigIntC bigint_helper_lucas_double(BigIntC left, BigIntC right,
+                                                    BigIntBarrettCtx* ctx) {
+
+	BigIntC square = bigint_mulmod_barrett(left, left, ctx);
+	BigIntC twice = bigint_add_bigint(right, right);
+	BigIntC difference = bigint_sub_bigint(square, twice);
+
+	BigIntC result = bigint_mod_barrett(difference, ctx);
+
+	free_bigint_without_reset(square);
+	free_bigint_without_reset(twice);
+	free_bigint_without_reset(difference);
+
+	return result;
+}
+
+// after this many values of D without a jacobi symbol of -1, big_int is checked to be a square, as
+// there is no such D for squares
+#define LUCAS_SQUARE_CHECK_AFTER 8
+
+// the strong lucas probable prime test of the odd big_int, that isn't divisible by a small prime,
+// with the parameters of selfridge: the first D of 5, -7, 9, -11, ... with (D / big_int) = -1,
+// P = 1 and Q = (1 - D) / 4, the lucas sequences U and V of big_int + 1 = odd * 2^twos are
+// calculated with the doubling formulas from the top bit of odd on
+NODISCARD static bool bigint_helper_strong_lucas_probable_prime(BigIntC big_int,
+                                                                BigIntBarrettCtx* ctx) {
+
+	int64_t value_d = 5;
+
+	{ // 1. find D
+		for(size_t tries = 1;; ++tries) {
+			const int8_t jacobi = bigint_helper_jacobi_small(value_d, big_int);
+
+			if(jacobi == -1) {
+				break;
+			}
+
+			// the magnitude of D is a factor, as big_int is bigger than D
+			if(jacobi == 0) {
+				return false;
+			}
+
+			if(tries == LUCAS_SQUARE_CHECK_AFTER) {
+				BigIntRootRemC root = bigint_sqrtrem(big_int);
+
+				const bool square = bigint_helper_is_zero(root.remainder);
+
+				free_bigint_without_reset(root.root);
+				free_bigint_without_reset(root.remainder);
+
+				if(square) {
+					return false;
+				}
+			}
+
+			value_d = value_d > 0 ? -(value_d + 2) : -value_d + 2;
+		}
+	}
+
+	const int64_t value_q = (1 - value_d) / 4;
+
+	BigIntC plus_one = bigint_add_u64(big_int, U64(1));
+	const size_t twos = bigint_ctz(plus_one);
+	BigIntC odd = bigint_helper_shift_right(plus_one, twos);
+
+	BigIntC value_u = bigint_from_unsigned_number(U64(1));
+	BigIntC value_v = bigint_from_unsigned_number(U64(1));
+	BigIntC power_q = bigint_from_signed_number(value_q);
+	bigint_helper_replace(&power_q, bigint_mod_barrett(power_q, ctx));
+
+	{ // 2. U_odd, V_odd and Q^odd, with U_2k = U_k * V_k, V_2k = V_k^2 - 2 * Q^k and
+	  // U_k+1 = (U_k + V_k) / 2, V_k+1 = (D * U_k + V_k) / 2
+		for(size_t i = bigint_bit_length(odd) - 1; i != 0; --i) {
+			bigint_helper_replace(&value_u, bigint_mulmod_barrett(value_u, value_v, ctx));
+			bigint_helper_replace(&value_v, bigint_helper_lucas_double(value_v, power_q, ctx));
+			bigint_helper_replace(&power_q, bigint_mulmod_barrett(power_q, power_q, ctx));
+
+			if(!bigint_test_bit(odd, i - 1)) {
+				continue;
+			}
+
+			BigIntC sum_u = bigint_add_bigint(value_u, value_v);
+
+			BigIntC product_d = bigint_mul_i64(value_u, value_d);
+			bigint_helper_replace(&product_d, bigint_mod_barrett(product_d, ctx));
+			BigIntC sum_v = bigint_add_bigint(product_d, value_v);
+
+			bigint_helper_replace(&value_u, bigint_helper_half_mod(sum_u, ctx));
+			bigint_helper_replace(&value_v, bigint_helper_half_mod(sum_v, ctx));
+
+			free_bigint_without_reset(sum_u);
+			free_bigint_without_reset(product_d);
+			free_bigint_without_reset(sum_v);
+
+			BigIntC product_q = bigint_mul_i64(power_q, value_q);
+			bigint_helper_replace(&power_q, bigint_mod_barrett(product_q, ctx));
+			free_bigint_without_reset(product_q);
+		}
+	}
+
+	bool result = bigint_helper_is_zero(value_u) || bigint_helper_is_zero(value_v);
+
+	{ // 3. V_odd*2^r for r < twos
+		for(size_t i = 1; i < twos && !result; ++i) {
+			bigint_helper_replace(&value_v, bigint_helper_lucas_double(value_v, power_q, ctx));
+			bigint_helper_replace(&power_q, bigint_mulmod_barrett(power_q, power_q, ctx));
+
+			result = bigint_helper_is_zero(value_v);
+		}
+	}
+
+	free_bigint_without_reset(plus_one);
+	free_bigint_without_reset(odd);
+	free_bigint_without_reset(value_u);
+	free_bigint_without_reset(value_v);
+	free_bigint_without_reset(power_q);
+
+	return result;
+}
+
+// the next base of the additional miller rabin rounds (splitmix64), so that the bases are the
+// same for every call
+NODISCARD static uint64_t helper_next_prime_base(uint64_t* state) {
+
+	*state += U64(0x9E3779B97F4A7C15);
+
+	uint64_t result = *state;
+	result = (result ^ (result >> 30)) * U64(0xBF58476D1CE4E5B9);
+	result = (result ^ (result >> 27)) * U64(0x94D049BB133111EB);
+
+	return result ^ (result >> 31);
+}
+
+// the baillie psw test (a strong probable prime test to the base 2 and a strong lucas test) and
+// more strong probable prime tests to pseudo random bases, for an odd big_int, that has no factor
+// below the trial bound and is bigger than its square
+NODISCARD static bool bigint_helper_is_probable_prime_bpsw(BigIntC big_int, size_t rounds) {
+
+	BigIntBarrettCtx ctx = bigint_barrett_ctx_from_modulus(big_int);
+
+	BigIntC minus_one = bigint_sub_u64(big_int, U64(1));
+	const size_t twos = bigint_ctz(minus_one);
+	BigIntC odd = bigint_helper_shift_right(minus_one, twos);
+
+	BigIntC base = bigint_from_unsigned_number(U64(2));
+
+	bool result = bigint_helper_strong_probable_prime(big_int, odd, twos, base, &ctx) &&
+	              bigint_helper_strong_lucas_probable_prime(big_int, &ctx);
+
+	uint64_t state = U64(0);
+
+	for(size_t i = 0; i < rounds && result; ++i) {
+		uint64_t value = helper_next_prime_base(&state);
+
+		// the base has to be in [2, big_int - 2]
+		if(big_int.number_count == 1) {
+			value = 2 + (value % (big_int.numbers[0] - 3));
+		} else {
+			value = 2 + (value >> 1);
+		}
+
+		base.numbers[0] = value;
+
+		result = bigint_helper_strong_probable_prime(big_int, odd, twos, base, &ctx);
+	}
+
+	free_bigint_without_reset(base);
+	free_bigint_without_reset(odd);
+	free_bigint_without_reset(minus_one);
+	free_bigint_barrett_ctx(&ctx);
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED bool bigint_is_probable_prime(BigIntC big_int, size_t rounds) {
+
+	if(!big_int.positive || bigint_cmp_u64(big_int, U64(3)) <= 0) {
+		return big_int.positive && bigint_cmp_u64(big_int, U64(2)) >= 0;
+	}
+
+	if((big_int.numbers[0] & 0x01) == 0) {
+		return false;
+	}
+
+	{ // 1. trial division, with one remainder of the product of the small primes
+		SmallPrimes primes = helper_small_primes_below(BIGINT_PRIME_TRIAL_BOUND);
+
+		uint64_t* const residues = bigint_helper_allocate_scratch(primes.count);
+
+		bigint_helper_small_prime_residues(residues, big_int, &primes, true);
+
+		bool has_factor = false;
+
+		for(size_t i = 0; i < primes.count && !has_factor; ++i) {
+			has_factor = residues[i] == 0;
+
+			// a small prime is only divisible by itself
+			if(has_factor && bigint_eq_u64(big_int, primes.primes[i])) {
+				free(residues);
+				free_small_primes(&primes);
+				return true;
+			}
+		}
+
+		free(residues);
+		free_small_primes(&primes);
+
+		if(has_factor) {
+			return false;
+		}
+
+		// without a factor below the square root, it is a prime
+		if(bigint_cmp_u64(big_int, (uint64_t)BIGINT_PRIME_TRIAL_BOUND * BIGINT_PRIME_TRIAL_BOUND) <
+		   0) {
+			return true;
+		}
+	}
+
+	// 2. the baillie psw test and the additional rounds
+	return bigint_helper_is_probable_prime_bpsw(big_int, rounds);
+}
+
+// the most threads, that bigint_next_prime uses
+#ifndef BIGINT_PRIME_MAX_THREADS
+#define BIGINT_PRIME_MAX_THREADS 64
+#endif
+
+// a candidate of bigint_next_prime, that survived the sieve
+typedef struct {
+	BigIntC candidate;
+	bool prime;
+} PrimeCandidate;
+
+#if defined(BIGINT_C_USE_THREADS) && BIGINT_C_USE_THREADS == 1
+
+static int bigint_helper_prime_candidate_worker(void* argument) {
+
+	PrimeCandidate* const candidate = (PrimeCandidate*)argument;
+
+	candidate->prime = bigint_helper_is_probable_prime_bpsw(candidate->candidate, 0);
+
+	return 0;
+}
+
+#endif
+
+// tests all candidates, every candidate but the first in its own thread, if the library is built
+// with threads, if a thread can't be started, its candidate is tested in the calling thread
+static void bigint_helper_test_prime_candidates(PrimeCandidate* candidates, size_t count) {
+
+	if(count == 0) {
+		return;
+	}
+
+#if defined(BIGINT_C_USE_THREADS) && BIGINT_C_USE_THREADS == 1
+
+	thrd_t workers[BIGINT_PRIME_MAX_THREADS];
+	bool started[BIGINT_PRIME_MAX_THREADS];
+
+	for(size_t i = 1; i < count; ++i) {
+		started[i] = thrd_create(&(workers[i]), bigint_helper_prime_candidate_worker,
+		                         &(candidates[i])) == thrd_success;
+	}
+
+	candidates[0].prime = bigint_helper_is_probable_prime_bpsw(candidates[0].candidate, 0);
+
+	for(size_t i = 1; i < count; ++i) {
+		if(started[i]) {
+			thrd_join(workers[i], NULL);
+		} else {
+			candidates[i].prime = bigint_helper_is_probable_prime_bpsw(candidates[i].candidate, 0);
+		}
+	}
+
+#else
+
+	for(size_t i = 0; i < count; ++i) {
+		candidates[i].prime = bigint_helper_is_probable_prime_bpsw(candidates[i].candidate, 0);
+	}
+
+#endif
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_next_prime(BigIntC big_int, size_t threads) {
+
+	if(!big_int.positive || bigint_cmp_u64(big_int, U64(2)) < 0) {
+		return bigint_from_unsigned_number(U64(2));
+	}
+
+	// the first odd number after big_int
+	BigIntC start = bigint_add_u64(big_int, (big_int.numbers[0] & 0x01) == 0 ? 1 : 2);
+
+	// small candidates are tested one by one, as they could be one of the sieving primes
+	if(bigint_cmp_u64(start, BIGINT_PRIME_SIEVE_BOUND) < 0) {
+		while(!bigint_is_probable_prime(start, 0)) {
+			bigint_helper_replace(&start, bigint_add_u64(start, U64(2)));
+		}
+
+		return start;
+	}
+
+#if defined(BIGINT_C_USE_THREADS) && BIGINT_C_USE_THREADS == 1
+	threads = threads == 0 ? 1 : helper_min(threads, BIGINT_PRIME_MAX_THREADS);
+#else
+	threads = 1;
+#endif
+
+	// the residues of the start of the window modulo every sieving prime, they are only updated
+	// for every window, instead of dividing every candidate again
+	SmallPrimes primes = helper_small_primes_below(BIGINT_PRIME_SIEVE_BOUND);
+
+	uint64_t* const residues = bigint_helper_allocate_scratch(primes.count);
+
+	bigint_helper_small_prime_residues(residues, start, &primes, false);
+
+	bool* const composite = (bool*)malloc(sizeof(bool) * BIGINT_PRIME_SIEVE_WINDOW);
+
+	if(composite == NULL) { // GCOVR_EXCL_BR_LINE (OOM)
+		UNREACHABLE_WITH_MSG( // GCOVR_EXCL_LINE (OOM content)
+		    "malloc failed, no error handling implemented here");
+	} // GCOVR_EXCL_LINE (OOM content)
+
+	PrimeCandidate candidates[BIGINT_PRIME_MAX_THREADS];
+
+	BigIntC result = { .positive = true, .numbers = NULL, .number_count = 0 };
+
+	while(result.numbers == NULL) {
+
+		{ // 1. sieve the window of the candidates start + 2 * i
+			memset(composite, 0, sizeof(bool) * BIGINT_PRIME_SIEVE_WINDOW);
+
+			for(size_t i = 0; i < primes.count; ++i) {
+				const uint64_t prime = primes.primes[i];
+
+				// start + 2 * index = 0 mod prime, for index = -residue / 2 mod prime
+				for(uint64_t index = (((prime - residues[i]) % prime) * ((prime + 1) / 2)) % prime;
+				    index < BIGINT_PRIME_SIEVE_WINDOW; index += prime) {
+					composite[index] = true;
+				}
+
+				residues[i] = (residues[i] + (2 * BIGINT_PRIME_SIEVE_WINDOW)) % prime;
+			}
+		}
+
+		{ // 2. test the remaining candidates in order, in batches of one candidate per thread
+			size_t index = 0;
+
+			while(index < BIGINT_PRIME_SIEVE_WINDOW && result.numbers == NULL) {
+				size_t count = 0;
+
+				for(; index < BIGINT_PRIME_SIEVE_WINDOW && count < threads; ++index) {
+					if(!composite[index]) {
+						candidates[count].candidate = bigint_add_u64(start, 2 * index);
+						++count;
+					}
+				}
+
+				bigint_helper_test_prime_candidates(candidates, count);
+
+				for(size_t i = 0; i < count; ++i) {
+					if(result.numbers == NULL && candidates[i].prime) {
+						result = candidates[i].candidate;
+					} else {
+						free_bigint_without_reset(candidates[i].candidate);
+					}
+				}
+			}
+		}
+
+		bigint_helper_replace(&start, bigint_add_u64(start, 2 * BIGINT_PRIME_SIEVE_WINDOW));
+	}
+
+	free(composite);
+	free(residues);
+	free_small_primes(&primes);
+	free_bigint_without_reset(start);
+
+	return result;
+}
+
+// combinatorics
+
+// products of at most this many numbers are multiplied one number after another, above that the
+// product tree splits them in halves
+#ifndef BIGINT_PRODUCT_TREE_LEAF_COUNT
+#define BIGINT_PRODUCT_TREE_LEAF_COUNT 16
+#endif
+
+// the product of the numbers with a balanced product tree, so the multiplications at the top have
+// operands of about the same size, which the subquadratic multiplications need, instead of one
+// big and one small operand, like the product from left to right
+NODISCARD static BigIntC // NOLINTNEXTLINE(misc-no-recursion)
+bigint_helper_product_of_numbers(const uint64_t* numbers, size_t count) {
+
+	if(count <= BIGINT_PRODUCT_TREE_LEAF_COUNT) {
+		BigIntC result = bigint_from_unsigned_number(U64(1));
+
+		for(size_t i = 0; i < count; ++i) {
+			bigint_helper_replace(&result, bigint_mul_u64(result, numbers[i]));
+		}
+
+		return result;
+	}
+
+	const size_t half = count / 2;
+
+	BigIntC left = bigint_helper_product_of_numbers(numbers, half);
+	BigIntC right = bigint_helper_product_of_numbers(numbers + half, count - half);
+
+	BigIntC result = bigint_mul_bigint(left, right);
+
+	free_bigint_without_reset(left);
+	free_bigint_without_reset(right);
+
+	return result;
+}
+
+// appends the factor to the last number of the factors, if the product fits, so the leaves of the
+// product tree have about 64 bits
+static void helper_append_factor(uint64_t* factors, size_t* count, uint64_t factor) {
+
+	if(*count != 0 && factors[*count - 1] <= UINT64_MAX / factor) {
+		factors[*count - 1] *= factor;
+		return;
+	}
+
+	factors[*count] = factor;
+	++(*count);
+}
+
+// the odd part of the swing number n! / floor(n / 2)!^2 (Luschny), the product of p^e over the odd
+// primes p <= n, with e = sum of floor(n / p^i) mod 2, so that p^e <= n, the primes have to
+// contain all odd primes <= n, factors needs as many numbers as there are primes
+NODISCARD static BigIntC bigint_helper_odd_swing(uint64_t number, const SmallPrimes* primes,
+                                                 uint64_t* factors) {
+
+	size_t count = 0;
+
+	for(size_t i = 0; i < primes->count && primes->primes[i] <= number; ++i) {
+		const uint64_t prime = primes->primes[i];
+
+		uint64_t power = U64(1);
+
+		for(uint64_t quotient = number / prime; quotient != 0; quotient = quotient / prime) {
+			if((quotient & 0x01) != 0) {
+				power *= prime;
+			}
+		}
+
+		if(power != 1) {
+			helper_append_factor(factors, &count, power);
+		}
+	}
+
+	return bigint_helper_product_of_numbers(factors, count);
+}
+
+// the factorials up to this fit into one number
+#define FACTORIAL_NUMBER_LIMIT 20
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_factorial(uint64_t number) {
+
+	if(number <= FACTORIAL_NUMBER_LIMIT) {
+		uint64_t result = U64(1);
+
+		for(uint64_t i = 2; i <= number; ++i) {
+			result *= i;
+		}
+
+		return bigint_from_unsigned_number(result);
+	}
+
+	SmallPrimes primes = helper_small_primes_below(number + 1);
+
+	uint64_t* const factors = bigint_helper_allocate_scratch(primes.count);
+
+	// the odd part of n! is the odd part of floor(n / 2)!^2 times the odd part of swing(n), from
+	// the top bit of n on
+	BigIntC result = bigint_from_unsigned_number(U64(1));
+
+	for(size_t shift = bigint_helper_bits_of_number_used(number); shift != 0; --shift) {
+		BigIntC swing = bigint_helper_odd_swing(number >> (shift - 1), &primes, factors);
+		BigIntC square = bigint_sqr(result);
+
+		bigint_helper_replace(&result, bigint_mul_bigint(square, swing));
+
+		free_bigint_without_reset(swing);
+		free_bigint_without_reset(square);
+	}
+
+	free(factors);
+	free_small_primes(&primes);
+
+	// n! has n - popcount(n) factors of 2 (Legendre)
+	bigint_shl_in_place(&result, number - helper_popcount(number));
+
+	return result;
+}
+
+// if n is at most this many times k, the binomial coefficient is the product of the prime powers of
+// its factorization, as the sieve up to n is then cheaper than the numerator n! / (n - k)!, that is
+// a lot bigger than the result
+#ifndef BIGINT_BINOMIAL_PRIME_RATIO
+#define BIGINT_BINOMIAL_PRIME_RATIO 64
+#endif
+
+// n choose k as the product of p^e over the primes p <= n, where e is the amount of carries, when
+// k and n - k are added in base p (Kummer), so that p^e <= n
+NODISCARD static BigIntC bigint_helper_binomial_of_primes(uint64_t number, uint64_t count) {
+
+	SmallPrimes primes = helper_small_primes_below(number + 1);
+
+	uint64_t* const factors = bigint_helper_allocate_scratch(primes.count);
+
+	size_t factor_count = 0;
+
+	for(size_t i = 0; i < primes.count; ++i) {
+		const uint64_t prime = primes.primes[i];
+
+		uint64_t power = U64(1);
+
+		// the carry into a digit is floor(n / p^j) - floor(k / p^j) - floor((n - k) / p^j)
+		for(uint64_t top = number / prime, left = count / prime, right = (number - count) / prime;
+		    top != 0; top = top / prime, left = left / prime, right = right / prime) {
+			if(top != left + right) {
+				power *= prime;
+			}
+		}
+
+		if(power != 1) {
+			helper_append_factor(factors, &factor_count, power);
+		}
+	}
+
+	BigIntC result = bigint_helper_product_of_numbers(factors, factor_count);
+
+	free(factors);
+	free_small_primes(&primes);
+
+	// the carries of k + (n - k) in base 2
+	bigint_shl_in_place(&result, helper_popcount(count) + helper_popcount(number - count) -
+	                                 helper_popcount(number));
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_binomial(uint64_t number, uint64_t count) {
+
+	if(count > number) {
+		return bigint_helper_zero();
+	}
+
+	count = count > number - count ? number - count : count;
+
+	if(count == 0) {
+		return bigint_from_unsigned_number(U64(1));
+	}
+
+	if(number / BIGINT_BINOMIAL_PRIME_RATIO <= count) {
+		return bigint_helper_binomial_of_primes(number, count);
+	}
+
+	// n * (n - 1) * ... * (n - k + 1) with a product tree, divided by k!
+	uint64_t* const factors = bigint_helper_allocate_scratch(count);
+
+	size_t factor_count = 0;
+
+	for(uint64_t i = 0; i < count; ++i) {
+		helper_append_factor(factors, &factor_count, number - i);
+	}
+
+	BigIntC numerator = bigint_helper_product_of_numbers(factors, factor_count);
+
+	free(factors);
+
+	BigIntC denominator = bigint_factorial(count);
+
+	BigIntC result = bigint_divexact(numerator, denominator);
+
+	free_bigint_without_reset(numerator);
+	free_bigint_without_reset(denominator);
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_primorial(uint64_t number) {
+
+	if(number < 2) {
+		return bigint_from_unsigned_number(U64(1));
+	}
+
+	// the products of the groups of primes already are the leaves of the product tree
+	SmallPrimes primes = helper_small_primes_below(number + 1);
+
+	BigIntC result = bigint_helper_product_of_numbers(primes.group_products, primes.group_count);
+
+	free_small_primes(&primes);
+
+	// the only even prime
+	bigint_shl_in_place(&result, 1);
+
+	return result;
+}
+
+// product trees
+
+// inner nodes with at least this many bits are multiplied, after their children were computed in
+// parallel, if the library is built with threads
+#ifndef BIGINT_PRODUCT_PARALLEL_BITS
+#define BIGINT_PRODUCT_PARALLEL_BITS 65536
+#endif
+
+// the most threads, that bigint_product uses
+#ifndef BIGINT_PRODUCT_MAX_THREADS
+#define BIGINT_PRODUCT_MAX_THREADS 4
+#endif
+
+// a node of the min heap of huffman's algorithm, ordered by weight and then by node
+typedef struct {
+	uint64_t weight;
+	size_t node;
+} ProductHeapEntry;
+
+NODISCARD static bool helper_product_heap_less(ProductHeapEntry entry1, ProductHeapEntry entry2) {
+	return entry1.weight < entry2.weight ||
+	       (entry1.weight == entry2.weight && entry1.node < entry2.node);
+}
+
+static void helper_product_heap_push(ProductHeapEntry* heap, size_t* size, ProductHeapEntry entry) {
+
+	size_t index = *size;
+	++(*size);
+
+	while(index != 0 && helper_product_heap_less(entry, heap[(index - 1) / 2])) {
+		heap[index] = heap[(index - 1) / 2];
+		index = (index - 1) / 2;
+	}
+
+	heap[index] = entry;
+}
+
+NODISCARD static ProductHeapEntry helper_product_heap_pop(ProductHeapEntry* heap, size_t* size) {
+
+	const ProductHeapEntry result = heap[0];
+
+	--(*size);
+	const ProductHeapEntry last = heap[*size];
+
+	size_t index = 0;
+
+	while((2 * index) + 1 < *size) {
+		size_t child = (2 * index) + 1;
+
+		if(child + 1 < *size && helper_product_heap_less(heap[child + 1], heap[child])) {
+			++child;
+		}
+
+		if(!helper_product_heap_less(heap[child], last)) {
+			break;
+		}
+
+		heap[index] = heap[child];
+		index = child;
+	}
+
+	heap[index] = last;
+
+	return result;
+}
+
+// the shape of the product tree (huffman's algorithm), the bit length of a product is about the
+// sum of the bit lengths, so the two products with the fewest bits are merged into a new inner
+// node, until only the root is left, weights gets the estimated bits of all 2 * count - 1 nodes
+static void bigint_helper_product_tree_shape(const BigIntC* values, size_t count,
+                                             size_t* children, uint64_t* weights) {
+
+	ProductHeapEntry* const heap = (ProductHeapEntry*)malloc(sizeof(ProductHeapEntry) * count);
+
+	if(heap == NULL) { // GCOVR_EXCL_BR_LINE (OOM)
+		UNREACHABLE_WITH_MSG( // GCOVR_EXCL_LINE (OOM content)
+		    "malloc failed, no error handling implemented here");
+	} // GCOVR_EXCL_LINE (OOM content)
+
+	size_t size = 0;
+
+	for(size_t i = 0; i < count; ++i) {
+		const size_t bits = bigint_helper_bit_length(values[i]);
+
+		weights[i] = bits == 0 ? 1 : bits;
+		helper_product_heap_push(heap, &size, (ProductHeapEntry){ .weight = weights[i], .node = i });
+	}
+
+	for(size_t node = count; size > 1; ++node) {
+		const ProductHeapEntry left = helper_product_heap_pop(heap, &size);
+		const ProductHeapEntry right = helper_product_heap_pop(heap, &size);
+
+		children[2 * (node - count)] = left.node;
+		children[(2 * (node - count)) + 1] = right.node;
+		weights[node] = left.weight + right.weight;
+
+		helper_product_heap_push(heap, &size,
+		                         (ProductHeapEntry){ .weight = weights[node], .node = node });
+	}
+
+	free(heap);
+}
+
+// the state of the multiplication of a product tree, the leaves are already set, if the inner
+// nodes aren't kept, they are freed, as soon as their parent is computed
+typedef struct {
+	BigIntC* nodes;
+	const size_t* children;
+	const uint64_t* weights;
+	size_t count;
+	bool keep_nodes;
+} ProductTreeState;
+
+static void bigint_helper_product_tree_node(ProductTreeState* state, size_t node, size_t threads);
+
+#if defined(BIGINT_C_USE_THREADS) && BIGINT_C_USE_THREADS == 1
+
+// a subtree, that a worker thread computes
+typedef struct {
+	ProductTreeState* state;
+	size_t node;
+	size_t threads;
+} ProductTreeTask;
+
+static int bigint_helper_product_tree_worker(void* argument) {
+
+	ProductTreeTask* const task = (ProductTreeTask*)argument;
+
+	bigint_helper_product_tree_node(task->state, task->node, task->threads);
+
+	return 0;
+}
+
+#endif
+
+// computes the node from its children, every node is written by exactly one thread, big nodes
+// split the threads between the subtrees of their children
+static void // NOLINTNEXTLINE(misc-no-recursion)
+bigint_helper_product_tree_node(ProductTreeState* state, size_t node, size_t threads) {
+
+	if(node < state->count) {
+		return;
+	}
+
+	const size_t left = state->children[2 * (node - state->count)];
+	const size_t right = state->children[(2 * (node - state->count)) + 1];
+
+	bool computed = false;
+
+#if defined(BIGINT_C_USE_THREADS) && BIGINT_C_USE_THREADS == 1
+
+	if(threads > 1 && state->weights[node] >= BIGINT_PRODUCT_PARALLEL_BITS) {
+		ProductTreeTask task = { .state = state, .node = left, .threads = threads / 2 };
+
+		thrd_t worker;
+		const bool started =
+		    thrd_create(&worker, bigint_helper_product_tree_worker, &task) == thrd_success;
+
+		if(!started) {
+			bigint_helper_product_tree_node(state, left, 1);
+		}
+
+		bigint_helper_product_tree_node(state, right, threads - (threads / 2));
+
+		if(started) {
+			thrd_join(worker, NULL);
+		}
+
+		computed = true;
+	}
+
+#endif
+
+	if(!computed) {
+		bigint_helper_product_tree_node(state, left, threads);
+		bigint_helper_product_tree_node(state, right, threads);
+	}
+
+	state->nodes[node] = bigint_mul_bigint(state->nodes[left], state->nodes[right]);
+
+	if(!state->keep_nodes) {
+		if(left >= state->count) {
+			free_bigint_without_reset(state->nodes[left]);
+		}
+
+		if(right >= state->count) {
+			free_bigint_without_reset(state->nodes[right]);
+		}
+	}
+}
+
+// the children of the inner nodes of a product tree of count values, a count of 1 returns NULL
+NODISCARD static size_t* helper_allocate_product_children(size_t count) {
+
+	if(count == 1) {
+		return NULL;
+	}
+
+	size_t* const children = (size_t*)malloc(sizeof(size_t) * 2 * (count - 1));
+
+	if(children == NULL) { // GCOVR_EXCL_BR_LINE (OOM)
+		UNREACHABLE_WITH_MSG( // GCOVR_EXCL_LINE (OOM content)
+		    "malloc failed, no error handling implemented here");
+	} // GCOVR_EXCL_LINE (OOM content)
+
+	return children;
+}
+
+// the threads of the product trees
+NODISCARD static size_t helper_product_tree_threads(void) {
+#if defined(BIGINT_C_USE_THREADS) && BIGINT_C_USE_THREADS == 1
+	return BIGINT_PRODUCT_MAX_THREADS;
+#else
+	return 1;
+#endif
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_product(const BigIntC* values, size_t count) {
+
+	if(count == 0) {
+		return bigint_from_unsigned_number(U64(1));
+	}
+
+	if(count == 1) {
+		return bigint_copy(values[0]);
+	}
+
+	const size_t node_count = (2 * count) - 1;
+
+	// the leaves are the values themselves, as they aren't freed
+	BigIntC* const nodes = (BigIntC*)malloc(sizeof(BigIntC) * node_count);
+
+	if(nodes == NULL) { // GCOVR_EXCL_BR_LINE (OOM)
+		UNREACHABLE_WITH_MSG( // GCOVR_EXCL_LINE (OOM content)
+		    "malloc failed, no error handling implemented here");
+	} // GCOVR_EXCL_LINE (OOM content)
+
+	memcpy(nodes, values, sizeof(BigIntC) * count);
+
+	size_t* const children = helper_allocate_product_children(count);
+	uint64_t* const weights = bigint_helper_allocate_scratch(node_count);
+
+	bigint_helper_product_tree_shape(values, count, children, weights);
+
+	ProductTreeState state = { .nodes = nodes,
+		                       .children = children,
+		                       .weights = weights,
+		                       .count = count,
+		                       .keep_nodes = false };
+
+	bigint_helper_product_tree_node(&state, node_count - 1, helper_product_tree_threads());
+
+	const BigIntC result = nodes[node_count - 1];
+
+	free(nodes);
+	free(children);
+	free(weights);
+
+	return result;
+}
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntProductTree bigint_product_tree(const BigIntC* values,
+                                                                      size_t count) {
+
+	if(count == 0) {
+		UNREACHABLE_WITH_MSG("a product tree needs at least one value");
+	}
+
+	const size_t node_count = (2 * count) - 1;
+
+	BigIntProductTree result = { .nodes = (BigIntC*)malloc(sizeof(BigIntC) * node_count),
+		                         .children = helper_allocate_product_children(count),
+		                         .count = count };
+
+	if(result.nodes == NULL) { // GCOVR_EXCL_BR_LINE (OOM)
+		UNREACHABLE_WITH_MSG( // GCOVR_EXCL_LINE (OOM content)
+		    "malloc failed, no error handling implemented here");
+	} // GCOVR_EXCL_LINE (OOM content)
+
+	for(size_t i = 0; i < count; ++i) {
+		result.nodes[i] = bigint_copy(values[i]);
+	}
+
+	uint64_t* const weights = bigint_helper_allocate_scratch(node_count);
+
+	bigint_helper_product_tree_shape(values, count, result.children, weights);
+
+	ProductTreeState state = { .nodes = result.nodes,
+		                       .children = result.children,
+		                       .weights = weights,
+		                       .count = count,
+		                       .keep_nodes = true };
+
+	bigint_helper_product_tree_node(&state, node_count - 1, helper_product_tree_threads());
+
+	free(weights);
+
+	return result;
+}
+
+BIGINT_C_LIB_EXPORTED void free_bigint_product_tree(BigIntProductTree* tree) {
+
+	if(tree == NULL) {
+		return;
+	}
+
+	if(tree->nodes != NULL) {
+		for(size_t i = 0; i < (2 * tree->count) - 1; ++i) {
+			free_bigint_without_reset(tree->nodes[i]);
+		}
+	}
+
+	free(tree->nodes);
+	tree->nodes = NULL;
+
+	free(tree->children);
+	tree->children = NULL;
+
+	tree->count = 0;
+}
+
 // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic,misc-use-anonymous-namespace,modernize-use-auto,modernize-use-using,cppcoreguidelines-no-malloc)
@@ -41,6 +41,82 @@ typedef struct {
 	} data;
 } MaybeBigIntC;
 
+typedef struct {
+	BigIntC quotient;
+	BigIntC remainder;
+} BigIntDivModC;
+
+typedef struct {
+	uint64_t divisor;
+	uint64_t normalized;
+	uint64_t reciprocal;
+	size_t shift;
+} BigIntDivisorU64;
+
+typedef struct {
+	BigIntC quotient;
+	uint64_t remainder;
+} BigIntDivModU64C;
+
+// the precomputed values of an odd modulus for montgomery arithmetic, the fields are only read by
+// the library, use bigint_mont_ctx_from_modulus and free_bigint_mont_ctx
+typedef struct {
+	BigIntC modulus;
+	uint64_t inverse;    // -modulus^-1 mod 2^64
+	uint64_t* r_squared; // R^2 mod modulus, with R = 2^(64 * modulus.number_count)
+	uint64_t* scratch;   // the memory of the exponentiation, so that it doesn't need to allocate
+} BigIntMontCtx;
+
+// the comb table of a fixed base, the fields are only read by the library, use
+// bigint_fixed_base_ctx_from and free_bigint_fixed_base_ctx
+typedef struct {
+	BigIntMontCtx mont;
+	BigIntC base;
+	size_t exponent_bits; // the bits, that the table covers
+	size_t teeth;         // the amount of rows of the comb, the table has 2^teeth entries
+	size_t spacing;       // the bits per row
+	uint64_t* table;
+} BigIntFixedBaseCtx;
+
+// the precomputed reciprocal of a modulus for barrett reduction, the fields are only read by the
+// library, use bigint_barrett_ctx_from_modulus and free_bigint_barrett_ctx
+typedef struct {
+	BigIntC modulus;
+	BigIntC reciprocal; // floor(2^(128 * modulus.number_count) / modulus)
+	uint64_t* scratch;  // the memory of the reduction, so that it doesn't need to allocate
+} BigIntBarrettCtx;
+
+// a modulus of the form 2^bits - offset, the fields are only read by the library, use
+// bigint_special_ctx_from_modulus or bigint_special_ctx_from_form and free_bigint_special_ctx
+typedef struct {
+	BigIntC modulus;
+	size_t bits;
+	uint64_t offset;   // at most bits / 2 bits, 0 for powers of two
+	uint64_t* scratch; // the memory of the reduction, so that it doesn't need to allocate
+} BigIntSpecialCtx;
+
+// gcd = big_int1 * factor1 + big_int2 * factor2
+typedef struct {
+	BigIntC gcd;
+	BigIntC factor1;
+	BigIntC factor2;
+} BigIntGcdExtC;
+
+// big_int = root^degree + remainder
+typedef struct {
+	BigIntC root;
+	BigIntC remainder;
+} BigIntRootRemC;
+
+// the nodes of a product tree, that are kept for remainder trees, the first count nodes are copies
+// of the values, the inner node count + i has the children children[2 * i] and
+// children[2 * i + 1], which have smaller indices, the last node nodes[2 * count - 2] is the root
+typedef struct {
+	BigIntC* nodes;
+	size_t* children;
+	size_t count;
+} BigIntProductTree;
+
 // NOLINTEND(modernize-use-using)
 
 // functions on maybe bigint
@@ -125,4 +201,852 @@ NODISCARD BIGINT_C_LIB_EXPORTED int8_t bigint_compare_bigint(BigIntC big_int1, B
 
 BIGINT_C_LIB_EXPORTED void bigint_negate(BigIntC* big_int);
 
+/**
+ * @brief Multiplies two bigints, if both arguments are the same bigint (they share their numbers),
+ * this automatically uses the faster bigint_sqr
+ *
+ * @param big_int1
+ * @param big_int2
+ * @return BigIntC - the result
+ */
 NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mul_bigint(BigIntC big_int1, BigIntC big_int2);
+
+/**
+ * @brief Squares a bigint, this is faster than multiplying two different bigints, as almost half
+ * of the partial products can be skipped
+ *
+ * @param big_int
+ * @return BigIntC - the result, it is always positive
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_sqr(BigIntC big_int);
+
+// low level functions on raw numbers
+
+// these work on raw arrays of numbers (limbs), like they are stored in BigIntC, that means the
+// least significant number comes first, they never allocate and don't normalize anything, so they
+// can be used to write own kernels, the result can always be the same array as the (first) input,
+// but it shouldn't overlap it partially
+
+/**
+ * @brief result = numbers1 + numbers2, all have count numbers
+ *
+ * @param result
+ * @param numbers1
+ * @param numbers2
+ * @param count
+ * @return uint64_t - the carry out of the top number (0 or 1)
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_add_n(uint64_t* result,
+                                                            const uint64_t* numbers1,
+                                                            const uint64_t* numbers2,
+                                                            size_t count);
+
+/**
+ * @brief result = numbers1 - numbers2, all have count numbers
+ *
+ * @param result
+ * @param numbers1
+ * @param numbers2
+ * @param count
+ * @return uint64_t - the borrow out of the top number (0 or 1)
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_sub_n(uint64_t* result,
+                                                            const uint64_t* numbers1,
+                                                            const uint64_t* numbers2,
+                                                            size_t count);
+
+/**
+ * @brief result = numbers + value, both result and numbers have count numbers
+ *
+ * @param result
+ * @param numbers
+ * @param count
+ * @param value
+ * @return uint64_t - the carry out of the top number (0 or 1, or value, if count is 0)
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_add_1(uint64_t* result,
+                                                            const uint64_t* numbers, size_t count,
+                                                            uint64_t value);
+
+/**
+ * @brief result = numbers - value, both result and numbers have count numbers
+ *
+ * @param result
+ * @param numbers
+ * @param count
+ * @param value
+ * @return uint64_t - the borrow out of the top number (0 or 1, or value, if count is 0)
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_sub_1(uint64_t* result,
+                                                            const uint64_t* numbers, size_t count,
+                                                            uint64_t value);
+
+/**
+ * @brief result = numbers * factor, both result and numbers have count numbers
+ *
+ * @param result
+ * @param numbers
+ * @param count
+ * @param factor
+ * @return uint64_t - the number, that doesn't fit into result anymore
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_mul_1(uint64_t* result,
+                                                            const uint64_t* numbers, size_t count,
+                                                            uint64_t factor);
+
+/**
+ * @brief result += numbers * factor, both result and numbers have count numbers
+ *
+ * @param result
+ * @param numbers
+ * @param count
+ * @param factor
+ * @return uint64_t - the number, that doesn't fit into result anymore
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_addmul_1(uint64_t* result,
+                                                               const uint64_t* numbers,
+                                                               size_t count, uint64_t factor);
+
+/**
+ * @brief result -= numbers * factor, both result and numbers have count numbers
+ *
+ * @param result
+ * @param numbers
+ * @param count
+ * @param factor
+ * @return uint64_t - the number, that has to be borrowed from above the top of result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_submul_1(uint64_t* result,
+                                                               const uint64_t* numbers,
+                                                               size_t count, uint64_t factor);
+
+/**
+ * @brief result = numbers << shift, both result and numbers have count numbers
+ *
+ * @param result - can also be the same as numbers or lie above it
+ * @param numbers
+ * @param count
+ * @param shift - has to be less than 64
+ * @return uint64_t - the bits shifted out at the top, in the low bits of the return value
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_lshift(uint64_t* result,
+                                                             const uint64_t* numbers, size_t count,
+                                                             unsigned int shift);
+
+/**
+ * @brief result = numbers >> shift, both result and numbers have count numbers
+ *
+ * @param result - can also be the same as numbers or lie below it
+ * @param numbers
+ * @param count
+ * @param shift - has to be less than 64
+ * @return uint64_t - the bits shifted out at the bottom, in the high bits of the return value
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_rshift(uint64_t* result,
+                                                             const uint64_t* numbers, size_t count,
+                                                             unsigned int shift);
+
+/**
+ * @brief Compares two arrays of count numbers, like bigint_compare_bigint does for positive bigints
+ *
+ * @param numbers1
+ * @param numbers2
+ * @param count
+ * @return 0, -1 or 1
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED int8_t bigint_limbs_cmp(const uint64_t* numbers1,
+                                                        const uint64_t* numbers2, size_t count);
+
+/**
+ * @brief Copies count numbers, the arrays can overlap
+ *
+ * @param result
+ * @param numbers
+ * @param count
+ */
+BIGINT_C_LIB_EXPORTED void bigint_limbs_copy(uint64_t* result, const uint64_t* numbers,
+                                             size_t count);
+
+/**
+ * @brief Divides count numbers by the precomputed divisor, quotient gets count numbers, it can be
+ * the same as numbers or NULL, if only the remainder is needed
+ *
+ * @param quotient
+ * @param numbers
+ * @param count
+ * @param divisor - see bigint_divisor_u64_from_number
+ * @return uint64_t - the remainder
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_limbs_divrem_1_pre(uint64_t* quotient,
+                                                                   const uint64_t* numbers,
+                                                                   size_t count,
+                                                                   BigIntDivisorU64 divisor);
+
+// mixed functions with native numbers, these are faster than converting the native number into a
+// bigint first, as they don't need to allocate a temporary bigint
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_add_u64(BigIntC big_int, uint64_t value);
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_add_i64(BigIntC big_int, int64_t value);
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_sub_u64(BigIntC big_int, uint64_t value);
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_sub_i64(BigIntC big_int, int64_t value);
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mul_u64(BigIntC big_int, uint64_t value);
+
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mul_i64(BigIntC big_int, int64_t value);
+
+NODISCARD BIGINT_C_LIB_EXPORTED bool bigint_eq_u64(BigIntC big_int, uint64_t value);
+
+NODISCARD BIGINT_C_LIB_EXPORTED bool bigint_eq_i64(BigIntC big_int, int64_t value);
+
+/**
+ * @brief This compares a bigint with a native number, the return value is the same as in
+ * bigint_compare_bigint
+ *
+ * @param big_int
+ * @param value
+ * @return 0, -1 or 1
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED int8_t bigint_cmp_u64(BigIntC big_int, uint64_t value);
+
+/**
+ * @brief This compares a bigint with a native number, the return value is the same as in
+ * bigint_compare_bigint
+ *
+ * @param big_int
+ * @param value
+ * @return 0, -1 or 1
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED int8_t bigint_cmp_i64(BigIntC big_int, int64_t value);
+
+// shifts
+
+/**
+ * @brief Shifts big_int to the left, this is big_int * 2^amount
+ *
+ * @param big_int
+ * @param amount - the amount of bits
+ * @return BigIntC - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_shl(BigIntC big_int, size_t amount);
+
+/**
+ * @brief Shifts big_int to the right, this is floor(big_int / 2^amount), so negative numbers are
+ * rounded towards negative infinity, like an arithmetic shift in two's complement
+ *
+ * @param big_int
+ * @param amount - the amount of bits
+ * @return BigIntC - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_shr(BigIntC big_int, size_t amount);
+
+/**
+ * @brief The same as bigint_shl, but it modifies big_int, the numbers are only moved, if the
+ * allocation can't grow in place
+ *
+ * @param big_int
+ * @param amount - the amount of bits
+ */
+BIGINT_C_LIB_EXPORTED void bigint_shl_in_place(BigIntC* big_int, size_t amount);
+
+/**
+ * @brief The same as bigint_shr, but it modifies big_int, this never needs a new allocation
+ *
+ * @param big_int
+ * @param amount - the amount of bits
+ */
+BIGINT_C_LIB_EXPORTED void bigint_shr_in_place(BigIntC* big_int, size_t amount);
+
+// bitwise operations
+
+/**
+ * @brief The bitwise and of big_int1 and big_int2, negative numbers behave like they were stored in
+ * two's complement with infinitely many bits, so the result is the same as for the builtin signed
+ * integers
+ *
+ * @param big_int1
+ * @param big_int2
+ * @return BigIntC - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_and(BigIntC big_int1, BigIntC big_int2);
+
+/**
+ * @brief The bitwise or of big_int1 and big_int2, see bigint_and for negative numbers
+ *
+ * @param big_int1
+ * @param big_int2
+ * @return BigIntC - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_or(BigIntC big_int1, BigIntC big_int2);
+
+/**
+ * @brief The bitwise xor of big_int1 and big_int2, see bigint_and for negative numbers
+ *
+ * @param big_int1
+ * @param big_int2
+ * @return BigIntC - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_xor(BigIntC big_int1, BigIntC big_int2);
+
+/**
+ * @brief The bitwise complement of big_int, in two's complement this is -big_int - 1
+ *
+ * @param big_int
+ * @return BigIntC - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_not(BigIntC big_int);
+
+// bit queries and manipulation
+
+/**
+ * @brief The amount of bits, that are needed to store the absolute value of big_int, 0 for 0
+ *
+ * @param big_int
+ * @return size_t - the bit length
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED size_t bigint_bit_length(BigIntC big_int);
+
+/**
+ * @brief The amount of set bits of the absolute value of big_int
+ *
+ * @param big_int
+ * @return size_t - the amount of set bits
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED size_t bigint_popcount(BigIntC big_int);
+
+/**
+ * @brief The amount of trailing zero bits of big_int, this is the same for the absolute value and
+ * the two's complement, 0 has no set bit, so this returns 0 for it
+ *
+ * @param big_int
+ * @return size_t - the amount of trailing zero bits
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED size_t bigint_ctz(BigIntC big_int);
+
+/**
+ * @brief Tests the bit at index, negative numbers behave like they were stored in two's complement
+ * with infinitely many bits, like for bigint_and
+ *
+ * @param big_int
+ * @param index - the index of the bit, 0 is the least significant one
+ * @return bool - if the bit is set
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED bool bigint_test_bit(BigIntC big_int, size_t index);
+
+/**
+ * @brief Sets the bit at index in place, see bigint_test_bit for negative numbers, the numbers are
+ * only reallocated, if the bit is above the top number
+ *
+ * @param big_int
+ * @param index - the index of the bit, 0 is the least significant one
+ */
+BIGINT_C_LIB_EXPORTED void bigint_set_bit(BigIntC* big_int, size_t index);
+
+/**
+ * @brief Clears the bit at index in place, see bigint_test_bit for negative numbers
+ *
+ * @param big_int
+ * @param index - the index of the bit, 0 is the least significant one
+ */
+BIGINT_C_LIB_EXPORTED void bigint_clear_bit(BigIntC* big_int, size_t index);
+
+// division
+
+/**
+ * @brief Divides two bigints, the quotient is truncated (rounded towards 0), like the division of
+ * native numbers in C, so the remainder has the sign of the dividend and dividend = quotient *
+ * divisor + remainder holds
+ *
+ * @param dividend
+ * @param divisor - this can't be 0
+ * @return BigIntDivModC - the quotient and the remainder, both have to be freed
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntDivModC bigint_divmod(BigIntC dividend, BigIntC divisor);
+
+/**
+ * @brief Divides two bigints, the quotient is floored (rounded towards negative infinity), so the
+ * remainder has the sign of the divisor and dividend = quotient * divisor + remainder holds
+ *
+ * @param dividend
+ * @param divisor - this can't be 0
+ * @return BigIntDivModC - the quotient and the remainder, both have to be freed
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntDivModC bigint_divmod_floor(BigIntC dividend,
+                                                                  BigIntC divisor);
+
+/**
+ * @brief The truncated quotient of bigint_divmod
+ *
+ * @param dividend
+ * @param divisor - this can't be 0
+ * @return BigIntC - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_div(BigIntC dividend, BigIntC divisor);
+
+/**
+ * @brief The remainder of bigint_divmod, it has the sign of the dividend
+ *
+ * @param dividend
+ * @param divisor - this can't be 0
+ * @return BigIntC - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mod(BigIntC dividend, BigIntC divisor);
+
+/**
+ * @brief The floored quotient of bigint_divmod_floor
+ *
+ * @param dividend
+ * @param divisor - this can't be 0
+ * @return BigIntC - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_div_floor(BigIntC dividend, BigIntC divisor);
+
+/**
+ * @brief The remainder of bigint_divmod_floor, it has the sign of the divisor
+ *
+ * @param dividend
+ * @param divisor - this can't be 0
+ * @return BigIntC - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mod_floor(BigIntC dividend, BigIntC divisor);
+
+/**
+ * @brief The reciprocal 2^bits / big_int, truncated towards zero. For a dividend with |dividend| <
+ * 2^bits, (|dividend| * |reciprocal|) / 2^bits is the quotient |dividend| / |big_int| or one less,
+ * so dividing many times by the same big divisor only costs one multiplication and a correction
+ * each time. It is computed with a newton iteration, that doubles the precision in every step
+ *
+ * @param big_int - this can't be 0
+ * @param bits - the power of two, that is divided
+ * @return BigIntC - the result, it has the sign of big_int
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_reciprocal(BigIntC big_int, size_t bits);
+
+/**
+ * @brief Precomputes the reciprocal of divisor (Möller–Granlund), so that dividing by it only needs
+ * multiplications instead of a hardware division. Use this if you divide many times by the same
+ * number
+ *
+ * @param divisor - this can't be 0
+ * @return BigIntDivisorU64 - the precomputed divisor, it is a plain value and doesn't need to be
+ * freed
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntDivisorU64 bigint_divisor_u64_from_number(uint64_t divisor);
+
+/**
+ * @brief The truncated quotient and the remainder of dividend / divisor, with a precomputed
+ * divisor
+ *
+ * @param dividend
+ * @param divisor - see bigint_divisor_u64_from_number
+ * @return BigIntDivModU64C - the quotient has the sign of the dividend, the remainder is the one
+ * of |dividend|, so the truncated remainder is it with the sign of the dividend
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntDivModU64C bigint_divmod_u64_pre(BigIntC dividend,
+                                                                       BigIntDivisorU64 divisor);
+
+/**
+ * @brief The remainder of |dividend| / divisor, with a precomputed divisor, this doesn't allocate
+ *
+ * @param dividend
+ * @param divisor - see bigint_divisor_u64_from_number
+ * @return uint64_t - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED uint64_t bigint_mod_u64_pre(BigIntC dividend,
+                                                            BigIntDivisorU64 divisor);
+
+/**
+ * @brief The quotient dividend / divisor, if it is known, that the division is exact (the
+ * remainder is 0). This is several times faster than bigint_div, as no remainder is computed and
+ * the quotient doesn't need to be estimated. If the division is not exact, the result is
+ * undefined, debug builds assert that it is exact
+ *
+ * @param dividend - this has to be a multiple of the divisor
+ * @param divisor - this can't be 0
+ * @return BigIntC - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_divexact(BigIntC dividend, BigIntC divisor);
+
+/**
+ * @brief The same as bigint_divexact, but with a native number as divisor
+ *
+ * @param dividend - this has to be a multiple of the divisor
+ * @param divisor - this can't be 0
+ * @return BigIntC - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_divexact_u64(BigIntC dividend, uint64_t divisor);
+
+// exponentiation
+
+/**
+ * @brief The power base^exponent, 0^0 is 1. This uses a sliding window exponentiation, the result
+ * is computed in buffers, that are allocated once from the upper bound of its size, powers of two
+ * (and the power of two factor of the base) are just a shift
+ *
+ * @param base
+ * @param exponent
+ * @return BigIntC - the result
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_pow_u64(BigIntC base, uint64_t exponent);
+
+// modular exponentiation
+
+/**
+ * @brief Precomputes everything, that bigint_powm_mont needs for this modulus, the context can be
+ * reused for any amount of exponentiations with this modulus, but not from multiple threads at
+ * the same time, as it contains the scratch memory
+ *
+ * @param modulus - this has to be odd and positive
+ * @return BigIntMontCtx - the context, free it with free_bigint_mont_ctx
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntMontCtx bigint_mont_ctx_from_modulus(BigIntC modulus);
+
+/**
+ * @brief Frees the context, ctx can be NULL
+ *
+ * @param ctx
+ */
+BIGINT_C_LIB_EXPORTED void free_bigint_mont_ctx(BigIntMontCtx* ctx);
+
+/**
+ * @brief base^exponent mod the modulus of the context, this uses a fixed window exponentiation
+ * with montgomery multiplication, the only allocations are the reduction of the base and the
+ * result
+ *
+ * @param base - this can be negative and greater than the modulus
+ * @param exponent - this can't be negative
+ * @param ctx - see bigint_mont_ctx_from_modulus
+ * @return BigIntC - the result, it is in [0, modulus)
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_powm_mont(BigIntC base, BigIntC exponent,
+                                                        BigIntMontCtx* ctx);
+
+/**
+ * @brief base^exponent mod modulus, for odd moduli this uses a temporary montgomery context, for
+ * even ones a slower square and multiply with a division after every step
+ *
+ * @param base - this can be negative and greater than the modulus
+ * @param exponent - this can't be negative
+ * @param modulus - this can't be 0, the sign is ignored
+ * @return BigIntC - the result, it is in [0, |modulus|)
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_powm(BigIntC base, BigIntC exponent,
+                                                   BigIntC modulus);
+
+/**
+ * @brief Precomputes a comb table of base for bigint_powm_fixed_base, after that every
+ * exponentiation with an exponent of up to exponent_bits bits needs only about
+ * exponent_bits / teeth squarings and multiplications, where the table has 2^teeth entries. The
+ * context can be reused for any amount of exponentiations, but not from multiple threads at the
+ * same time, as it contains the scratch memory
+ *
+ * @param base - this can be negative and greater than the modulus
+ * @param modulus - this has to be odd and positive
+ * @param exponent_bits - the maximal amount of bits of the exponents, larger exponents are
+ * supported, but don't use the table
+ * @param memory_budget - the maximal size of the table in bytes, the table has at least 2
+ * entries, regardless of it
+ * @return BigIntFixedBaseCtx - the context, free it with free_bigint_fixed_base_ctx
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntFixedBaseCtx bigint_fixed_base_ctx_from(BigIntC base,
+                                                                              BigIntC modulus,
+                                                                              size_t exponent_bits,
+                                                                              size_t memory_budget);
+
+/**
+ * @brief Frees the context, ctx can be NULL
+ *
+ * @param ctx
+ */
+BIGINT_C_LIB_EXPORTED void free_bigint_fixed_base_ctx(BigIntFixedBaseCtx* ctx);
+
+/**
+ * @brief base^exponent mod modulus, with the base and modulus of the context
+ *
+ * @param exponent - this can't be negative
+ * @param ctx - see bigint_fixed_base_ctx_from
+ * @return BigIntC - the result, it is in [0, modulus)
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_powm_fixed_base(BigIntC exponent,
+                                                              BigIntFixedBaseCtx* ctx);
+
+/**
+ * @brief prod(bases[i]^exponents[i]) mod modulus, the squarings are shared by all bases, so this
+ * is a lot faster than count separate exponentiations, few bases use interleaved windows (Straus),
+ * many bases use buckets (Pippenger), so that large batches cost only a bit more than one
+ * exponentiation per base
+ *
+ * @param bases - these can be negative and greater than the modulus
+ * @param exponents - these can't be negative
+ * @param count - the amount of bases and exponents, the result for 0 is 1 mod modulus
+ * @param ctx - see bigint_mont_ctx_from_modulus
+ * @return BigIntC - the result, it is in [0, modulus)
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_multi_powm(const BigIntC* bases,
+                                                         const BigIntC* exponents, size_t count,
+                                                         BigIntMontCtx* ctx);
+
+// barrett reduction
+
+/**
+ * @brief Precomputes the reciprocal of the modulus for bigint_mod_barrett and
+ * bigint_mulmod_barrett, unlike a montgomery context this works for every modulus. The context
+ * can be reused for any amount of reductions, but not from multiple threads at the same time, as
+ * it contains the scratch memory
+ *
+ * @param modulus - this can't be 0, the sign is ignored
+ * @return BigIntBarrettCtx - the context, free it with free_bigint_barrett_ctx
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntBarrettCtx bigint_barrett_ctx_from_modulus(BigIntC modulus);
+
+/**
+ * @brief Frees the context, ctx can be NULL
+ *
+ * @param ctx
+ */
+BIGINT_C_LIB_EXPORTED void free_bigint_barrett_ctx(BigIntBarrettCtx* ctx);
+
+/**
+ * @brief big_int mod the modulus of the context, this needs two multiplications instead of a
+ * division for every 64 * modulus.number_count bits of big_int, the only allocation is the result
+ *
+ * @param big_int - this can be negative
+ * @param ctx - see bigint_barrett_ctx_from_modulus
+ * @return BigIntC - the result, it is in [0, modulus)
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mod_barrett(BigIntC big_int, BigIntBarrettCtx* ctx);
+
+/**
+ * @brief big_int1 * big_int2 mod the modulus of the context, if both have at most as many numbers
+ * as the modulus, the only allocation is the result
+ *
+ * @param big_int1
+ * @param big_int2
+ * @param ctx - see bigint_barrett_ctx_from_modulus
+ * @return BigIntC - the result, it is in [0, modulus)
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mulmod_barrett(BigIntC big_int1, BigIntC big_int2,
+                                                             BigIntBarrettCtx* ctx);
+
+// special form reduction
+
+/**
+ * @brief Checks, if |modulus| = 2^k - c with a c of at most k / 2 bits, like mersenne numbers,
+ * 2^255 - 19 or powers of two, for these the reduction needs only shifts and multiplications with
+ * one number, see bigint_special_ctx_from_modulus
+ *
+ * @param modulus
+ * @return bool - true, if there can be a special form context for it
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED bool bigint_is_special_modulus(BigIntC modulus);
+
+/**
+ * @brief Creates the context of the modulus 2^bits - offset for bigint_mod_special,
+ * bigint_mulmod_special and bigint_powm_special. The context can be reused for any amount of
+ * reductions, but not from multiple threads at the same time, as it contains the scratch memory
+ *
+ * @param bits - this can't be 0
+ * @param offset - this can have at most bits / 2 bits
+ * @return BigIntSpecialCtx - the context, free it with free_bigint_special_ctx
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntSpecialCtx bigint_special_ctx_from_form(size_t bits,
+                                                                              uint64_t offset);
+
+/**
+ * @brief Creates the context like bigint_special_ctx_from_form, with the form detected from the
+ * modulus
+ *
+ * @param modulus - bigint_is_special_modulus has to be true for it, the sign is ignored
+ * @return BigIntSpecialCtx - the context, free it with free_bigint_special_ctx
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntSpecialCtx bigint_special_ctx_from_modulus(BigIntC modulus);
+
+/**
+ * @brief Frees the context, ctx can be NULL
+ *
+ * @param ctx
+ */
+BIGINT_C_LIB_EXPORTED void free_bigint_special_ctx(BigIntSpecialCtx* ctx);
+
+/**
+ * @brief big_int mod the modulus of the context, the only allocation is the result
+ *
+ * @param big_int - this can be negative
+ * @param ctx - see bigint_special_ctx_from_form
+ * @return BigIntC - the result, it is in [0, modulus)
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mod_special(BigIntC big_int, BigIntSpecialCtx* ctx);
+
+/**
+ * @brief big_int1 * big_int2 mod the modulus of the context, if both have at most as many numbers
+ * as the modulus, the only allocation is the result
+ *
+ * @param big_int1
+ * @param big_int2
+ * @param ctx - see bigint_special_ctx_from_form
+ * @return BigIntC - the result, it is in [0, modulus)
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_mulmod_special(BigIntC big_int1, BigIntC big_int2,
+                                                             BigIntSpecialCtx* ctx);
+
+/**
+ * @brief base^exponent mod the modulus of the context, this works for even moduli as well,
+ * bigint_powm uses it for all moduli of this form
+ *
+ * @param base - this can be negative and greater than the modulus
+ * @param exponent - this can't be negative
+ * @param ctx - see bigint_special_ctx_from_form
+ * @return BigIntC - the result, it is in [0, modulus)
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_powm_special(BigIntC base, BigIntC exponent,
+                                                           BigIntSpecialCtx* ctx);
+
+// greatest common divisor
+
+/**
+ * @brief The greatest common divisor of |big_int1| and |big_int2|, with the lehmer algorithm on
+ * scratch memory, that is reused for all steps, big numbers are first reduced with the
+ * subquadratic half gcd, gcd(x, 0) is |x|
+ *
+ * @param big_int1
+ * @param big_int2
+ * @return BigIntC - the gcd, it isn't negative
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_gcd(BigIntC big_int1, BigIntC big_int2);
+
+/**
+ * @brief The gcd and the factors of the bezout identity, like bigint_gcd
+ *
+ * @param big_int1
+ * @param big_int2
+ * @return BigIntGcdExtC - gcd = big_int1 * factor1 + big_int2 * factor2, free all three
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntGcdExtC bigint_gcdext(BigIntC big_int1, BigIntC big_int2);
+
+/**
+ * @brief The modular inverse, if big_int and the modulus are coprime
+ *
+ * @param result - this gets big_int^-1 mod |modulus| in [0, |modulus|), if it exists, otherwise
+ * it isn't changed
+ * @param big_int - this can be negative and greater than the modulus
+ * @param modulus - this can't be 0, the sign is ignored
+ * @return bool - true, if the inverse exists
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED bool bigint_invert(BigIntC* result, BigIntC big_int,
+                                                   BigIntC modulus);
+
+// roots
+
+/**
+ * @brief The integer square root and its remainder, with the karatsuba square root, so it only
+ * takes a few multiplications and divisions of the full size
+ *
+ * @param big_int - this can't be negative
+ * @return BigIntRootRemC - root = floor(sqrt(big_int)), remainder = big_int - root^2, free both
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntRootRemC bigint_sqrtrem(BigIntC big_int);
+
+/**
+ * @brief The integer root of any degree and its remainder, with newton's method, that doubles the
+ * precision of the root of the top bits, starting from a root of at most 64 bits
+ *
+ * @param big_int - this can only be negative for odd degrees
+ * @param degree - this can't be 0
+ * @return BigIntRootRemC - the root is rounded towards 0, remainder = big_int - root^degree has
+ * the sign of big_int, free both
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntRootRemC bigint_rootrem(BigIntC big_int, uint64_t degree);
+
+// primes
+
+/**
+ * @brief A probable prime test, trial division by the small primes with one remainder of their
+ * product, then the baillie psw test (a strong probable prime test to the base 2 and a strong lucas
+ * test), that has no known counterexample, and more strong probable prime tests
+ *
+ * @param big_int - negative numbers, 0 and 1 aren't prime
+ * @param rounds - the amount of additional strong probable prime tests to pseudo random bases,
+ * that are the same for every call, 0 is just the baillie psw test
+ * @return bool - false, if big_int is composite, true, if it is a probable prime, numbers below
+ * the square of the trial division bound are proven
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED bool bigint_is_probable_prime(BigIntC big_int, size_t rounds);
+
+/**
+ * @brief The smallest probable prime, that is bigger than big_int, the candidates are sieved in
+ * windows by the small primes, whose residues are updated for every window, only the remaining
+ * candidates are tested with the baillie psw test
+ *
+ * @param big_int - this can be negative, the result is 2 then
+ * @param threads - the amount of candidates, that are tested at the same time in their own
+ * threads, 0 and 1 test them in the calling thread, this is ignored, if the library is built
+ * without threads, the result doesn't depend on it
+ * @return BigIntC - the next probable prime
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_next_prime(BigIntC big_int, size_t threads);
+
+// combinatorics
+
+/**
+ * @brief The factorial with the prime swing algorithm, n! = floor(n / 2)!^2 * swing(n), where the
+ * swing number is a product of small prime powers, so all products are balanced product trees
+ * and squarings, the factors of 2 are one shift at the end
+ *
+ * @param number
+ * @return BigIntC - number!
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_factorial(uint64_t number);
+
+/**
+ * @brief The binomial coefficient, for the smaller k of k and n - k, if k is not much smaller than
+ * n, it is the product of its prime factorization (Kummer) with a balanced product tree, otherwise
+ * the product of the top k factors of n! with a balanced product tree, divided exactly by k!
+ *
+ * @param number - n
+ * @param count - k
+ * @return BigIntC - n choose k, it is 0 for k > n
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_binomial(uint64_t number, uint64_t count);
+
+/**
+ * @brief The primorial, the product of all primes up to number, with the sieve of eratosthenes
+ * and a balanced product tree
+ *
+ * @param number
+ * @return BigIntC - the product of all primes <= number, it is 1 for numbers below 2
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_primorial(uint64_t number);
+
+/**
+ * @brief The product of all values with a product tree, that is built with huffman's algorithm on
+ * the bit lengths, so the two smallest products are always multiplied next, which is balanced for
+ * values of the same size and doesn't multiply big products with small values for values of
+ * different sizes, if the library is built with threads, independent big subtrees are multiplied
+ * in parallel, the result doesn't depend on it
+ *
+ * @param values - these can be negative
+ * @param count - the amount of values, the product of 0 values is 1
+ * @return BigIntC - the product
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntC bigint_product(const BigIntC* values, size_t count);
+
+/**
+ * @brief The same product tree as bigint_product, but all nodes are kept, so the tree can be used
+ * for a remainder tree, that reduces a number modulo every value
+ *
+ * @param values - these can be negative, they are copied
+ * @param count - this can't be 0
+ * @return BigIntProductTree - the tree, the root is the product, free it with
+ * free_bigint_product_tree
+ */
+NODISCARD BIGINT_C_LIB_EXPORTED BigIntProductTree bigint_product_tree(const BigIntC* values,
+                                                                      size_t count);
+
+/**
+ * @brief Frees the tree, tree can be NULL
+ *
+ * @param tree
+ */
+BIGINT_C_LIB_EXPORTED void free_bigint_product_tree(BigIntProductTree* tree);
@@ -0,0 +1,152 @@
+
+
+#include <bigint_c.h>
+
+#include <gmp.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// compares the division of this library with mpz_tdiv_qr from gmp, for balanced (2n / n) and
+// unbalanced operands, every result is also checked against the one from gmp
+
+namespace {
+
+// the numbers are in stored order (least significant first), the top one is never 0
+std::vector<uint64_t> get_random_numbers(size_t number_count, uint64_t seed) {
+
+	std::mt19937_64 generator{ seed };
+
+	std::vector<uint64_t> numbers(number_count);
+
+	for(uint64_t& number : numbers) {
+		number = generator();
+	}
+
+	numbers.back() = numbers.back() | 1ULL;
+
+	return numbers;
+}
+
+BigIntC get_bigint(const std::vector<uint64_t>& numbers) {
+	// bigint_from_list_of_numbers expects the most significant number first
+	const std::vector<uint64_t> reversed{ numbers.rbegin(), numbers.rend() };
+
+	return bigint_from_list_of_numbers(reversed.data(), reversed.size());
+}
+
+void set_mpz(mpz_t& result, const std::vector<uint64_t>& numbers) {
+	// -1 means the least significant number comes first, 0 is host endian and no nails
+	mpz_import(result, numbers.size(), -1, sizeof(uint64_t), 0, 0, numbers.data());
+}
+
+bool is_same(const BigIntC& big_int, const mpz_t& number) {
+
+	std::vector<uint64_t> numbers(mpz_size(number) + 1);
+	size_t count = 0;
+
+	mpz_export(numbers.data(), &count, -1, sizeof(uint64_t), 0, 0, number);
+
+	if(count == 0) {
+		return big_int.number_count == 1 && big_int.numbers[0] == 0;
+	}
+
+	if(count != big_int.number_count) {
+		return false;
+	}
+
+	for(size_t i = 0; i < count; ++i) {
+		if(numbers[i] != big_int.numbers[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename Fn> double measure_micro_seconds(size_t repetitions, Fn&& function) {
+
+	const auto start = std::chrono::steady_clock::now();
+
+	for(size_t i = 0; i < repetitions; ++i) {
+		function();
+	}
+
+	const auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::micro>(end - start).count() /
+	       static_cast<double>(repetitions);
+}
+
+void benchmark_division(size_t dividend_count, size_t divisor_count) {
+
+	const std::vector<uint64_t> dividend_numbers = get_random_numbers(dividend_count, dividend_count);
+	const std::vector<uint64_t> divisor_numbers =
+	    get_random_numbers(divisor_count, divisor_count + 1);
+
+	BigIntC dividend = get_bigint(dividend_numbers);
+	BigIntC divisor = get_bigint(divisor_numbers);
+
+	mpz_t dividend_gmp;
+	mpz_t divisor_gmp;
+	mpz_t quotient_gmp;
+	mpz_t remainder_gmp;
+	mpz_inits(dividend_gmp, divisor_gmp, quotient_gmp, remainder_gmp, nullptr);
+
+	set_mpz(dividend_gmp, dividend_numbers);
+	set_mpz(divisor_gmp, divisor_numbers);
+
+	// about the same amount of work for every size
+	const size_t repetitions = 1 + (20000000 / (dividend_count * divisor_count));
+
+	const double time_bigint = measure_micro_seconds(repetitions, [&dividend, &divisor]() {
+		BigIntDivModC result = bigint_divmod(dividend, divisor);
+		free_bigint(&result.quotient);
+		free_bigint(&result.remainder);
+	});
+
+	const double time_gmp = measure_micro_seconds(repetitions, [&]() {
+		mpz_tdiv_qr(quotient_gmp, remainder_gmp, dividend_gmp, divisor_gmp);
+	});
+
+	BigIntDivModC result = bigint_divmod(dividend, divisor);
+
+	if(!is_same(result.quotient, quotient_gmp) || !is_same(result.remainder, remainder_gmp)) {
+		throw std::runtime_error("the result is not the same as the one from gmp");
+	}
+
+	std::printf("%8zu / %6zu numbers: bigint_divmod %12.2f us, mpz_tdiv_qr %12.2f us, ratio %6.2f\n",
+	            dividend_count, divisor_count, time_bigint, time_gmp, time_bigint / time_gmp);
+
+	free_bigint(&result.quotient);
+	free_bigint(&result.remainder);
+	free_bigint(&dividend);
+	free_bigint(&divisor);
+	mpz_clears(dividend_gmp, divisor_gmp, quotient_gmp, remainder_gmp, nullptr);
+}
+
+} // namespace
+
+int main() {
+
+	const std::vector<std::pair<size_t, size_t>> sizes{
+		{ 2, 1 },        { 20, 10 },     { 60, 30 },     { 120, 60 },   { 200, 100 },
+		{ 400, 200 },    { 1000, 500 },  { 2000, 1000 }, { 4000, 2000 }, { 10000, 5000 },
+		{ 20000, 10000 }, { 10000, 100 }, { 10000, 1000 }
+	};
+
+	try {
+		for(const auto& [dividend_count, divisor_count] : sizes) {
+			benchmark_division(dividend_count, divisor_count);
+		}
+	} catch(const std::exception& error) {
+		std::fprintf(stderr, "%s\n", error.what());
+		return 1;
+	}
+
+	return 0;
+}
@@ -13,6 +13,8 @@
 #error "unknown TEST_BACKEND_USE_IMPLEMENTATION"
 #endif
 
+#include <bit>
+#include <random>
 #include <stdexcept>
 
 BigIntTest::BigIntTest(bool positive, std::vector<uint64_t> values) noexcept
@@ -70,6 +72,40 @@ BigIntTest& BigIntTest::operator=(BigIntTest&& big_int) noexcept {
 	return true;
 }
 
+[[nodiscard]] BigInt get_big_int_from_numbers(const std::vector<uint64_t>& numbers,
+                                              bool positive) {
+
+	// bigint_from_list_of_numbers expects the most significant number first
+	std::vector<uint64_t> reversed{ numbers.rbegin(), numbers.rend() };
+
+	BigIntC result = bigint_from_list_of_numbers(reversed.data(), reversed.size());
+
+	if(!positive) {
+		bigint_negate(&result);
+	}
+
+	return BigInt{ std::move(result) };
+}
+
+[[nodiscard]] BigInt get_random_big_int(size_t number_count, uint64_t seed, bool positive) {
+
+	std::mt19937_64 generator{ seed };
+
+	std::vector<uint64_t> numbers{};
+	numbers.reserve(number_count);
+
+	for(size_t i = 0; i < number_count; ++i) {
+		numbers.push_back(generator());
+	}
+
+	// the most significant number can't be 0, otherwise it would be trimmed
+	if(number_count != 0) {
+		numbers.back() = numbers.back() | 1ULL;
+	}
+
+	return get_big_int_from_numbers(numbers, positive);
+}
+
 [[nodiscard]] bool bigint::operator==(const bigint::ParseError& error1,
                                       const bigint::ParseError& error2) {
 	if(error1.index() != error2.index()) {
@@ -313,247 +349,969 @@ BigIntTest::BigIntTest(const int64_t& number) : m_values{} {
 	return result;
 }
 
-#elif TEST_BACKEND_USE_IMPLEMENTATION == 1
-
-#define CHECK_MP_ERROR(err) \
-	do { \
-		if(err != MP_OKAY) { \
-			throw std::runtime_error{ mp_error_to_string(err) }; \
-		} \
-	} while(false)
+[[nodiscard]] BigIntTest BigIntTest::operator/(const BigIntTest& value2) const {
 
-static void initialize_bigint_from_tommath(BigIntTest& test, mp_int&& number) {
+	const MPZWrapper number1 = get_gmp_value_from_bigint(*this);
 
-	mp_order order =
-	    MP_LSB_FIRST; // -1 means the least significant uint64_t comes first, as we store it.
-	mp_endian endian = MP_NATIVE_ENDIAN; // host endian
-	size_t nails = 0;                    // use all 64 bits of the number
+	const MPZWrapper number2 = get_gmp_value_from_bigint(value2);
 
-	size_t num_chunks = mp_pack_count(&number, nails, sizeof(uint64_t));
+	// see: https://gmplib.org/manual/Integer-Division
+	mpz_t result_number;
+	mpz_init(result_number);
 
-	std::vector<uint64_t> values{};
-	values.resize(num_chunks);
+	mpz_tdiv_q(result_number, *number1, *number2);
 
-	size_t written = 0;
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
 
-	mp_err error = mp_pack((void*)(values.data()), num_chunks, &written, order, sizeof(uint64_t),
-	                       endian, nails, &number);
+	return result;
+}
 
-	CHECK_MP_ERROR(error);
+[[nodiscard]] BigIntTest BigIntTest::operator%(const BigIntTest& value2) const {
 
-	if(written > num_chunks) {
-		throw std::runtime_error("values were written out of bounds");
-	}
+	const MPZWrapper number1 = get_gmp_value_from_bigint(*this);
 
-	values.resize(written);
+	const MPZWrapper number2 = get_gmp_value_from_bigint(value2);
 
-	bool positive = !mp_isneg(&number);
+	// see: https://gmplib.org/manual/Integer-Division
+	mpz_t result_number;
+	mpz_init(result_number);
 
-	if(written == 0) {
-		if(mp_iszero(&number)) {
-			values.resize(1);
-			values.at(0) = 0;
-		}
-	}
+	mpz_tdiv_r(result_number, *number1, *number2);
 
-	mp_clear(&number);
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
 
-	test = BigIntTest(positive, std::move(values));
+	return result;
 }
 
-#include <memory>
+[[nodiscard]] BigIntTest BigIntTest::div_floor(const BigIntTest& value2) const {
 
-namespace {
+	const MPZWrapper number1 = get_gmp_value_from_bigint(*this);
 
-class MPWrapper {
-  private:
-	std::shared_ptr<mp_int> m_value;
+	const MPZWrapper number2 = get_gmp_value_from_bigint(value2);
 
-  public:
-	MPWrapper() : m_value{ nullptr } {
-		mp_int* value = new mp_int{};
+	// see: https://gmplib.org/manual/Integer-Division
+	mpz_t result_number;
+	mpz_init(result_number);
 
-		mp_err error = mp_init(value);
-		if(error != MP_OKAY) {
-			delete value;
-			throw std::runtime_error{ mp_error_to_string(error) };
-		}
+	mpz_fdiv_q(result_number, *number1, *number2);
 
-		m_value = std::shared_ptr<mp_int>(value, [](mp_int* p) {
-			mp_clear(p);
-			delete p;
-		});
-	}
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
 
-	MPWrapper(const MPWrapper&) = default;
-	MPWrapper& operator=(const MPWrapper&) = default;
+	return result;
+}
 
-	[[nodiscard]] const mp_int* get() const { return m_value.get(); }
-	[[nodiscard]] const mp_int* operator*() const { return m_value.get(); }
+[[nodiscard]] BigIntTest BigIntTest::mod_floor(const BigIntTest& value2) const {
 
-	[[nodiscard]] mp_int* get() { return m_value.get(); }
-	[[nodiscard]] mp_int* operator*() { return m_value.get(); }
+	const MPZWrapper number1 = get_gmp_value_from_bigint(*this);
 
-	~MPWrapper() = default;
+	const MPZWrapper number2 = get_gmp_value_from_bigint(value2);
 
-	MPWrapper(MPWrapper&& number) noexcept = default;
+	// see: https://gmplib.org/manual/Integer-Division
+	mpz_t result_number;
+	mpz_init(result_number);
 
-	MPWrapper& operator=(MPWrapper&& number) = default;
-};
+	mpz_fdiv_r(result_number, *number1, *number2);
 
-} // namespace
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
 
-static MPWrapper get_tommath_value_from_bigint(const BigIntTest& test) {
+	return result;
+}
 
-	MPWrapper bigint{};
+[[nodiscard]] BigIntTest BigIntTest::operator<<(size_t amount) const {
 
-	mp_order order =
-	    MP_LSB_FIRST; // -1 means the least significant uint64_t comes first, as we store it.
-	mp_endian endian = MP_NATIVE_ENDIAN; // host endian
-	size_t nails = 0;                    // use all 64 bits of the number
+	const MPZWrapper number = get_gmp_value_from_bigint(*this);
 
-	mp_err error = mp_unpack(*bigint, test.values().size(), order, sizeof(uint64_t), endian, nails,
-	                         (void*)(test.values().data()));
+	// see: https://gmplib.org/manual/Integer-Arithmetic
+	mpz_t result_number;
+	mpz_init(result_number);
 
-	CHECK_MP_ERROR(error);
+	mpz_mul_2exp(result_number, *number, amount);
 
-	(*bigint)->sign = test.positive() ? MP_ZPOS : MP_NEG;
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
 
-	return bigint;
+	return result;
 }
 
-// the same algorithm as in c, but using a external library, to verify the test result
-// see https://gmplib.org/manual/Concept-Index for gmp docs
-BigIntTest::BigIntTest(const std::string& str) : m_values{} {
+[[nodiscard]] BigIntTest BigIntTest::operator>>(size_t amount) const {
 
-	// preprocess the string, to allow the same syntax as in the c library
-	std::string cleaned_str = str;
-	std::erase_if(cleaned_str, [](char digit) -> bool {
-		// Remove special characters like separators and also the "+" sign, as gmp doesn't allow
-		// that
-		return BigIntTest::is_special_separator(digit) || digit == '+';
-	});
+	const MPZWrapper number = get_gmp_value_from_bigint(*this);
 
-	mp_int bigint;
-	mp_err error = mp_init(&bigint);
-	CHECK_MP_ERROR(error);
+	// see: https://gmplib.org/manual/Integer-Division
+	mpz_t result_number;
+	mpz_init(result_number);
 
-	// Parse the decimal string into the big integer
-	error = mp_read_radix(&bigint, cleaned_str.c_str(), 10);
-	if(error != MP_OKAY) {
-		mp_clear(&bigint);
-		throw std::runtime_error("Failed to parse bigint string: " + str +
-		                         " (cleaned: " + cleaned_str + ")" + mp_error_to_string(error));
-	}
+	mpz_fdiv_q_2exp(result_number, *number, amount);
 
-	initialize_bigint_from_tommath(*this, std::move(bigint));
-}
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
 
-BigIntTest::BigIntTest(const uint64_t& number) : m_values{} {
-	mp_int bigint;
-	mp_err error = mp_init(&bigint);
-	CHECK_MP_ERROR(error);
+	return result;
+}
 
-	mp_set_u64(&bigint, number);
+[[nodiscard]] BigIntTest BigIntTest::operator&(const BigIntTest& value2) const {
 
-	initialize_bigint_from_tommath(*this, std::move(bigint));
-}
-BigIntTest::BigIntTest(const int64_t& number) : m_values{} {
-	mp_int bigint;
-	mp_err error = mp_init(&bigint);
-	CHECK_MP_ERROR(error);
+	const MPZWrapper number1 = get_gmp_value_from_bigint(*this);
 
-	mp_set_i64(&bigint, number);
+	const MPZWrapper number2 = get_gmp_value_from_bigint(value2);
 
-	initialize_bigint_from_tommath(*this, std::move(bigint));
-}
+	// see: https://gmplib.org/manual/Integer-Logic-and-Bit-Fiddling
+	mpz_t result_number;
+	mpz_init(result_number);
 
-[[nodiscard]] std::string BigIntTest::to_string() const {
-	MPWrapper number = get_tommath_value_from_bigint(*this);
+	mpz_and(result_number, *number1, *number2);
 
-	int needed_size = 0;
-	mp_err error = mp_radix_size(*number, 10, &needed_size);
-	CHECK_MP_ERROR(error);
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
 
-	needed_size += 1; // for the \0 terminator
+	return result;
+}
 
-	char* buffer = (char*)malloc(needed_size * sizeof(char));
+[[nodiscard]] BigIntTest BigIntTest::operator|(const BigIntTest& value2) const {
 
-	if(buffer == nullptr) {
-		throw std::runtime_error("string conversion error");
-	}
+	const MPZWrapper number1 = get_gmp_value_from_bigint(*this);
 
-	size_t written = 0;
+	const MPZWrapper number2 = get_gmp_value_from_bigint(value2);
 
-	error = mp_to_radix(*number, buffer, needed_size, &written, 10);
-	CHECK_MP_ERROR(error);
+	// see: https://gmplib.org/manual/Integer-Logic-and-Bit-Fiddling
+	mpz_t result_number;
+	mpz_init(result_number);
 
-	std::string str{ buffer };
+	mpz_ior(result_number, *number1, *number2);
 
-	free(buffer);
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
 
-	return str;
+	return result;
 }
 
-[[nodiscard]] BigIntTest BigIntTest::operator+(const BigIntTest& value2) const {
+[[nodiscard]] BigIntTest BigIntTest::operator^(const BigIntTest& value2) const {
 
-	const MPWrapper number1 = get_tommath_value_from_bigint(*this);
+	const MPZWrapper number1 = get_gmp_value_from_bigint(*this);
 
-	const MPWrapper number2 = get_tommath_value_from_bigint(value2);
+	const MPZWrapper number2 = get_gmp_value_from_bigint(value2);
 
-	mp_int result_number;
-	mp_err error = mp_init(&result_number);
-	CHECK_MP_ERROR(error);
+	// see: https://gmplib.org/manual/Integer-Logic-and-Bit-Fiddling
+	mpz_t result_number;
+	mpz_init(result_number);
 
-	error = mp_add(*number1, *number2, &result_number);
-	if(error != MP_OKAY) {
-		mp_clear(&result_number);
-		throw std::runtime_error{ mp_error_to_string(error) };
-	}
+	mpz_xor(result_number, *number1, *number2);
 
 	BigIntTest result{ false, {} };
-	initialize_bigint_from_tommath(result, std::move(result_number));
+	initialize_bigint_from_gmp(result, std::move(result_number));
 
 	return result;
 }
 
-[[nodiscard]] BigIntTest BigIntTest::operator-(const BigIntTest& value2) const {
+[[nodiscard]] BigIntTest BigIntTest::operator~() const {
 
-	const MPWrapper number1 = get_tommath_value_from_bigint(*this);
+	const MPZWrapper number = get_gmp_value_from_bigint(*this);
 
-	const MPWrapper number2 = get_tommath_value_from_bigint(value2);
+	// see: https://gmplib.org/manual/Integer-Logic-and-Bit-Fiddling
+	mpz_t result_number;
+	mpz_init(result_number);
 
-	mp_int result_number;
-	mp_err error = mp_init(&result_number);
-	CHECK_MP_ERROR(error);
+	mpz_com(result_number, *number);
 
-	error = mp_sub(*number1, *number2, &result_number);
-	if(error != MP_OKAY) {
-		mp_clear(&result_number);
-		throw std::runtime_error{ mp_error_to_string(error) };
-	}
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::pow(uint64_t exponent) const {
+
+	const MPZWrapper number = get_gmp_value_from_bigint(*this);
+
+	// see: https://gmplib.org/manual/Integer-Exponentiation
+	mpz_t result_number;
+	mpz_init(result_number);
+
+	mpz_pow_ui(result_number, *number, exponent);
 
 	BigIntTest result{ false, {} };
-	initialize_bigint_from_tommath(result, std::move(result_number));
+	initialize_bigint_from_gmp(result, std::move(result_number));
 
 	return result;
 }
 
-[[nodiscard]] BigIntTest BigIntTest::operator*(const BigIntTest& value2) const {
+[[nodiscard]] BigIntTest BigIntTest::powm(const BigIntTest& exponent,
+                                          const BigIntTest& modulus) const {
 
-	const MPWrapper number1 = get_tommath_value_from_bigint(*this);
+	const MPZWrapper number = get_gmp_value_from_bigint(*this);
 
-	const MPWrapper number2 = get_tommath_value_from_bigint(value2);
+	const MPZWrapper exponent_number = get_gmp_value_from_bigint(exponent);
 
-	mp_int result_number;
-	mp_err error = mp_init(&result_number);
-	CHECK_MP_ERROR(error);
+	const MPZWrapper modulus_number = get_gmp_value_from_bigint(modulus);
 
-	error = mp_mul(*number1, *number2, &result_number);
-	if(error != MP_OKAY) {
-		mp_clear(&result_number);
-		throw std::runtime_error{ mp_error_to_string(error) };
-	}
+	// see: https://gmplib.org/manual/Integer-Exponentiation
+	mpz_t result_number;
+	mpz_init(result_number);
+
+	mpz_powm(result_number, *number, *exponent_number, *modulus_number);
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::gcd(const BigIntTest& value2) const {
+
+	const MPZWrapper number1 = get_gmp_value_from_bigint(*this);
+
+	const MPZWrapper number2 = get_gmp_value_from_bigint(value2);
+
+	// see: https://gmplib.org/manual/Number-Theoretic-Functions
+	mpz_t result_number;
+	mpz_init(result_number);
+
+	mpz_gcd(result_number, *number1, *number2);
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] std::optional<BigIntTest> BigIntTest::invert(const BigIntTest& modulus) const {
+
+	const MPZWrapper number = get_gmp_value_from_bigint(*this);
+
+	const MPZWrapper modulus_number = get_gmp_value_from_bigint(modulus);
+
+	// everything is the inverse of everything modulo 1, the result is 0
+	if(mpz_cmpabs_ui(*modulus_number, 1) == 0) {
+		return BigIntTest{ true, { 0 } };
+	}
+
+	mpz_t result_number;
+	mpz_init(result_number);
+
+	if(mpz_invert(result_number, *number, *modulus_number) == 0) {
+		mpz_clear(result_number);
+		return std::nullopt;
+	}
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] std::pair<BigIntTest, BigIntTest> BigIntTest::rootrem(uint64_t degree) const {
+
+	const MPZWrapper number = get_gmp_value_from_bigint(*this);
+
+	// see: https://gmplib.org/manual/Integer-Roots
+	mpz_t root_number;
+	mpz_init(root_number);
+
+	mpz_t remainder_number;
+	mpz_init(remainder_number);
+
+	mpz_rootrem(root_number, remainder_number, *number, degree);
+
+	BigIntTest root{ false, {} };
+	initialize_bigint_from_gmp(root, std::move(root_number));
+
+	BigIntTest remainder{ false, {} };
+	initialize_bigint_from_gmp(remainder, std::move(remainder_number));
+
+	return { std::move(root), std::move(remainder) };
+}
+
+[[nodiscard]] bool BigIntTest::is_probable_prime() const {
+
+	if(!this->m_positive) {
+		return false;
+	}
+
+	const MPZWrapper number = get_gmp_value_from_bigint(*this);
+
+	// see: https://gmplib.org/manual/Number-Theoretic-Functions
+	return mpz_probab_prime_p(*number, 30) != 0;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::next_prime() const {
+
+	const MPZWrapper number = get_gmp_value_from_bigint(*this);
+
+	mpz_t result_number;
+	mpz_init(result_number);
+
+	mpz_nextprime(result_number, *number);
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::factorial(uint64_t number) {
+
+	// see: https://gmplib.org/manual/Number-Theoretic-Functions
+	mpz_t result_number;
+	mpz_init(result_number);
+
+	mpz_fac_ui(result_number, number);
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::binomial(uint64_t number, uint64_t count) {
+
+	mpz_t result_number;
+	mpz_init(result_number);
+
+	mpz_bin_uiui(result_number, number, count);
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::primorial(uint64_t number) {
+
+	mpz_t result_number;
+	mpz_init(result_number);
+
+	mpz_primorial_ui(result_number, number);
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_gmp(result, std::move(result_number));
+
+	return result;
+}
+
+#elif TEST_BACKEND_USE_IMPLEMENTATION == 1
+
+#define CHECK_MP_ERROR(err) \
+	do { \
+		if(err != MP_OKAY) { \
+			throw std::runtime_error{ mp_error_to_string(err) }; \
+		} \
+	} while(false)
+
+static void initialize_bigint_from_tommath(BigIntTest& test, mp_int&& number) {
+
+	mp_order order =
+	    MP_LSB_FIRST; // -1 means the least significant uint64_t comes first, as we store it.
+	mp_endian endian = MP_NATIVE_ENDIAN; // host endian
+	size_t nails = 0;                    // use all 64 bits of the number
+
+	size_t num_chunks = mp_pack_count(&number, nails, sizeof(uint64_t));
+
+	std::vector<uint64_t> values{};
+	values.resize(num_chunks);
+
+	size_t written = 0;
+
+	mp_err error = mp_pack((void*)(values.data()), num_chunks, &written, order, sizeof(uint64_t),
+	                       endian, nails, &number);
+
+	CHECK_MP_ERROR(error);
+
+	if(written > num_chunks) {
+		throw std::runtime_error("values were written out of bounds");
+	}
+
+	values.resize(written);
+
+	bool positive = !mp_isneg(&number);
+
+	if(written == 0) {
+		if(mp_iszero(&number)) {
+			values.resize(1);
+			values.at(0) = 0;
+		}
+	}
+
+	mp_clear(&number);
+
+	test = BigIntTest(positive, std::move(values));
+}
+
+#include <memory>
+
+namespace {
+
+class MPWrapper {
+  private:
+	std::shared_ptr<mp_int> m_value;
+
+  public:
+	MPWrapper() : m_value{ nullptr } {
+		mp_int* value = new mp_int{};
+
+		mp_err error = mp_init(value);
+		if(error != MP_OKAY) {
+			delete value;
+			throw std::runtime_error{ mp_error_to_string(error) };
+		}
+
+		m_value = std::shared_ptr<mp_int>(value, [](mp_int* p) {
+			mp_clear(p);
+			delete p;
+		});
+	}
+
+	MPWrapper(const MPWrapper&) = default;
+	MPWrapper& operator=(const MPWrapper&) = default;
+
+	[[nodiscard]] const mp_int* get() const { return m_value.get(); }
+	[[nodiscard]] const mp_int* operator*() const { return m_value.get(); }
+
+	[[nodiscard]] mp_int* get() { return m_value.get(); }
+	[[nodiscard]] mp_int* operator*() { return m_value.get(); }
+
+	~MPWrapper() = default;
+
+	MPWrapper(MPWrapper&& number) noexcept = default;
+
+	MPWrapper& operator=(MPWrapper&& number) = default;
+};
+
+} // namespace
+
+static MPWrapper get_tommath_value_from_bigint(const BigIntTest& test) {
+
+	MPWrapper bigint{};
+
+	mp_order order =
+	    MP_LSB_FIRST; // -1 means the least significant uint64_t comes first, as we store it.
+	mp_endian endian = MP_NATIVE_ENDIAN; // host endian
+	size_t nails = 0;                    // use all 64 bits of the number
+
+	mp_err error = mp_unpack(*bigint, test.values().size(), order, sizeof(uint64_t), endian, nails,
+	                         (void*)(test.values().data()));
+
+	CHECK_MP_ERROR(error);
+
+	(*bigint)->sign = test.positive() ? MP_ZPOS : MP_NEG;
+
+	return bigint;
+}
+
+// the same algorithm as in c, but using a external library, to verify the test result
+// see https://gmplib.org/manual/Concept-Index for gmp docs
+BigIntTest::BigIntTest(const std::string& str) : m_values{} {
+
+	// preprocess the string, to allow the same syntax as in the c library
+	std::string cleaned_str = str;
+	std::erase_if(cleaned_str, [](char digit) -> bool {
+		// Remove special characters like separators and also the "+" sign, as gmp doesn't allow
+		// that
+		return BigIntTest::is_special_separator(digit) || digit == '+';
+	});
+
+	mp_int bigint;
+	mp_err error = mp_init(&bigint);
+	CHECK_MP_ERROR(error);
+
+	// Parse the decimal string into the big integer
+	error = mp_read_radix(&bigint, cleaned_str.c_str(), 10);
+	if(error != MP_OKAY) {
+		mp_clear(&bigint);
+		throw std::runtime_error("Failed to parse bigint string: " + str +
+		                         " (cleaned: " + cleaned_str + ")" + mp_error_to_string(error));
+	}
+
+	initialize_bigint_from_tommath(*this, std::move(bigint));
+}
+
+BigIntTest::BigIntTest(const uint64_t& number) : m_values{} {
+	mp_int bigint;
+	mp_err error = mp_init(&bigint);
+	CHECK_MP_ERROR(error);
+
+	mp_set_u64(&bigint, number);
+
+	initialize_bigint_from_tommath(*this, std::move(bigint));
+}
+BigIntTest::BigIntTest(const int64_t& number) : m_values{} {
+	mp_int bigint;
+	mp_err error = mp_init(&bigint);
+	CHECK_MP_ERROR(error);
+
+	mp_set_i64(&bigint, number);
+
+	initialize_bigint_from_tommath(*this, std::move(bigint));
+}
+
+[[nodiscard]] std::string BigIntTest::to_string() const {
+	MPWrapper number = get_tommath_value_from_bigint(*this);
+
+	int needed_size = 0;
+	mp_err error = mp_radix_size(*number, 10, &needed_size);
+	CHECK_MP_ERROR(error);
+
+	needed_size += 1; // for the \0 terminator
+
+	char* buffer = (char*)malloc(needed_size * sizeof(char));
+
+	if(buffer == nullptr) {
+		throw std::runtime_error("string conversion error");
+	}
+
+	size_t written = 0;
+
+	error = mp_to_radix(*number, buffer, needed_size, &written, 10);
+	CHECK_MP_ERROR(error);
+
+	std::string str{ buffer };
+
+	free(buffer);
+
+	return str;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::operator+(const BigIntTest& value2) const {
+
+	const MPWrapper number1 = get_tommath_value_from_bigint(*this);
+
+	const MPWrapper number2 = get_tommath_value_from_bigint(value2);
+
+	mp_int result_number;
+	mp_err error = mp_init(&result_number);
+	CHECK_MP_ERROR(error);
+
+	error = mp_add(*number1, *number2, &result_number);
+	if(error != MP_OKAY) {
+		mp_clear(&result_number);
+		throw std::runtime_error{ mp_error_to_string(error) };
+	}
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_tommath(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::operator-(const BigIntTest& value2) const {
+
+	const MPWrapper number1 = get_tommath_value_from_bigint(*this);
+
+	const MPWrapper number2 = get_tommath_value_from_bigint(value2);
+
+	mp_int result_number;
+	mp_err error = mp_init(&result_number);
+	CHECK_MP_ERROR(error);
+
+	error = mp_sub(*number1, *number2, &result_number);
+	if(error != MP_OKAY) {
+		mp_clear(&result_number);
+		throw std::runtime_error{ mp_error_to_string(error) };
+	}
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_tommath(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::operator*(const BigIntTest& value2) const {
+
+	const MPWrapper number1 = get_tommath_value_from_bigint(*this);
+
+	const MPWrapper number2 = get_tommath_value_from_bigint(value2);
+
+	mp_int result_number;
+	mp_err error = mp_init(&result_number);
+	CHECK_MP_ERROR(error);
+
+	error = mp_mul(*number1, *number2, &result_number);
+	if(error != MP_OKAY) {
+		mp_clear(&result_number);
+		throw std::runtime_error{ mp_error_to_string(error) };
+	}
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_tommath(result, std::move(result_number));
+
+	return result;
+}
+
+namespace {
+
+// mp_div truncates, the floored quotient is one less, if the signs are different and the division
+// is not exact, the remainder has then the sign of the divisor
+void tommath_divmod(const BigIntTest& value1, const BigIntTest& value2, bool floor,
+                    mp_int* quotient, mp_int* remainder) {
+
+	const MPWrapper number1 = get_tommath_value_from_bigint(value1);
+
+	const MPWrapper number2 = get_tommath_value_from_bigint(value2);
+
+	mp_err error = mp_div(*number1, *number2, quotient, remainder);
+	CHECK_MP_ERROR(error);
+
+	if(floor && !mp_iszero(remainder) && (value1.positive() != value2.positive())) {
+		error = mp_sub_d(quotient, 1, quotient);
+		CHECK_MP_ERROR(error);
+
+		error = mp_add(remainder, *number2, remainder);
+		CHECK_MP_ERROR(error);
+	}
+}
+
+BigIntTest tommath_divmod_result(const BigIntTest& value1, const BigIntTest& value2, bool floor,
+                                 bool return_quotient) {
+
+	mp_int quotient;
+	mp_int remainder;
+	mp_err error = mp_init_multi(&quotient, &remainder, nullptr);
+	CHECK_MP_ERROR(error);
+
+	try {
+		tommath_divmod(value1, value2, floor, &quotient, &remainder);
+	} catch(...) {
+		mp_clear_multi(&quotient, &remainder, nullptr);
+		throw;
+	}
+
+	BigIntTest result{ false, {} };
+
+	if(return_quotient) {
+		mp_clear(&remainder);
+		initialize_bigint_from_tommath(result, std::move(quotient));
+	} else {
+		mp_clear(&quotient);
+		initialize_bigint_from_tommath(result, std::move(remainder));
+	}
+
+	return result;
+}
+
+} // namespace
+
+[[nodiscard]] BigIntTest BigIntTest::operator/(const BigIntTest& value2) const {
+	return tommath_divmod_result(*this, value2, false, true);
+}
+
+[[nodiscard]] BigIntTest BigIntTest::operator%(const BigIntTest& value2) const {
+	return tommath_divmod_result(*this, value2, false, false);
+}
+
+[[nodiscard]] BigIntTest BigIntTest::div_floor(const BigIntTest& value2) const {
+	return tommath_divmod_result(*this, value2, true, true);
+}
+
+[[nodiscard]] BigIntTest BigIntTest::mod_floor(const BigIntTest& value2) const {
+	return tommath_divmod_result(*this, value2, true, false);
+}
+
+[[nodiscard]] BigIntTest BigIntTest::operator<<(size_t amount) const {
+
+	const MPWrapper number = get_tommath_value_from_bigint(*this);
+
+	mp_int result_number;
+	mp_err error = mp_init(&result_number);
+	CHECK_MP_ERROR(error);
+
+	error = mp_mul_2d(*number, static_cast<int>(amount), &result_number);
+	if(error != MP_OKAY) {
+		mp_clear(&result_number);
+		throw std::runtime_error{ mp_error_to_string(error) };
+	}
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_tommath(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::operator>>(size_t amount) const {
+
+	const MPWrapper number = get_tommath_value_from_bigint(*this);
+
+	mp_int result_number;
+	mp_err error = mp_init(&result_number);
+	CHECK_MP_ERROR(error);
+
+	// mp_signed_rsh rounds towards negative infinity, unlike mp_div_2d
+	error = mp_signed_rsh(*number, static_cast<int>(amount), &result_number);
+	if(error != MP_OKAY) {
+		mp_clear(&result_number);
+		throw std::runtime_error{ mp_error_to_string(error) };
+	}
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_tommath(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::operator&(const BigIntTest& value2) const {
+
+	const MPWrapper number1 = get_tommath_value_from_bigint(*this);
+
+	const MPWrapper number2 = get_tommath_value_from_bigint(value2);
+
+	mp_int result_number;
+	mp_err error = mp_init(&result_number);
+	CHECK_MP_ERROR(error);
+
+	error = mp_and(*number1, *number2, &result_number);
+	if(error != MP_OKAY) {
+		mp_clear(&result_number);
+		throw std::runtime_error{ mp_error_to_string(error) };
+	}
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_tommath(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::operator|(const BigIntTest& value2) const {
+
+	const MPWrapper number1 = get_tommath_value_from_bigint(*this);
+
+	const MPWrapper number2 = get_tommath_value_from_bigint(value2);
+
+	mp_int result_number;
+	mp_err error = mp_init(&result_number);
+	CHECK_MP_ERROR(error);
+
+	error = mp_or(*number1, *number2, &result_number);
+	if(error != MP_OKAY) {
+		mp_clear(&result_number);
+		throw std::runtime_error{ mp_error_to_string(error) };
+	}
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_tommath(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::operator^(const BigIntTest& value2) const {
+
+	const MPWrapper number1 = get_tommath_value_from_bigint(*this);
+
+	const MPWrapper number2 = get_tommath_value_from_bigint(value2);
+
+	mp_int result_number;
+	mp_err error = mp_init(&result_number);
+	CHECK_MP_ERROR(error);
+
+	error = mp_xor(*number1, *number2, &result_number);
+	if(error != MP_OKAY) {
+		mp_clear(&result_number);
+		throw std::runtime_error{ mp_error_to_string(error) };
+	}
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_tommath(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::operator~() const {
+
+	const MPWrapper number = get_tommath_value_from_bigint(*this);
+
+	mp_int result_number;
+	mp_err error = mp_init(&result_number);
+	CHECK_MP_ERROR(error);
+
+	error = mp_complement(*number, &result_number);
+	if(error != MP_OKAY) {
+		mp_clear(&result_number);
+		throw std::runtime_error{ mp_error_to_string(error) };
+	}
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_tommath(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::pow(uint64_t exponent) const {
+
+	const MPWrapper number = get_tommath_value_from_bigint(*this);
+
+	mp_int result_number;
+	mp_err error = mp_init(&result_number);
+	CHECK_MP_ERROR(error);
+
+	mp_int square;
+	error = mp_init_copy(&square, *number);
+	if(error != MP_OKAY) {
+		mp_clear(&result_number);
+		throw std::runtime_error{ mp_error_to_string(error) };
+	}
+
+	// the exponent functions differ between the supported versions, so this is done by hand
+	mp_set_u64(&result_number, 1);
+
+	for(uint64_t remaining = exponent; remaining != 0; remaining = remaining >> 1) {
+		if((remaining & 0x01) != 0) {
+			error = mp_mul(&result_number, &square, &result_number);
+			if(error != MP_OKAY) {
+				mp_clear_multi(&result_number, &square, nullptr);
+				throw std::runtime_error{ mp_error_to_string(error) };
+			}
+		}
+
+		error = mp_mul(&square, &square, &square);
+		if(error != MP_OKAY) {
+			mp_clear_multi(&result_number, &square, nullptr);
+			throw std::runtime_error{ mp_error_to_string(error) };
+		}
+	}
+
+	mp_clear(&square);
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_tommath(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::powm(const BigIntTest& exponent,
+                                          const BigIntTest& modulus) const {
+
+	const MPWrapper number = get_tommath_value_from_bigint(*this);
+
+	const MPWrapper exponent_number = get_tommath_value_from_bigint(exponent);
+
+	MPWrapper modulus_number = get_tommath_value_from_bigint(modulus);
+
+	mp_int result_number;
+	mp_err error = mp_init(&result_number);
+	CHECK_MP_ERROR(error);
+
+	// the result of mp_exptmod has the sign of the modulus, so it is made positive first
+	error = mp_abs(*modulus_number, *modulus_number);
+	if(error == MP_OKAY) {
+		error = mp_exptmod(*number, *exponent_number, *modulus_number, &result_number);
+	}
+
+	if(error != MP_OKAY) {
+		mp_clear(&result_number);
+		throw std::runtime_error{ mp_error_to_string(error) };
+	}
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_tommath(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::gcd(const BigIntTest& value2) const {
+
+	const MPWrapper number1 = get_tommath_value_from_bigint(*this);
+
+	const MPWrapper number2 = get_tommath_value_from_bigint(value2);
+
+	mp_int result_number;
+	mp_err error = mp_init(&result_number);
+	CHECK_MP_ERROR(error);
+
+	error = mp_gcd(*number1, *number2, &result_number);
+
+	if(error != MP_OKAY) {
+		mp_clear(&result_number);
+		throw std::runtime_error{ mp_error_to_string(error) };
+	}
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_tommath(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] std::optional<BigIntTest> BigIntTest::invert(const BigIntTest& modulus) const {
+
+	const MPWrapper number = get_tommath_value_from_bigint(*this);
+
+	MPWrapper modulus_number = get_tommath_value_from_bigint(modulus);
+
+	mp_int result_number;
+	mp_err error = mp_init(&result_number);
+	CHECK_MP_ERROR(error);
+
+	error = mp_abs(*modulus_number, *modulus_number);
+	CHECK_MP_ERROR(error);
+
+	// everything is the inverse of everything modulo 1, the result is 0
+	if(mp_cmp_d(*modulus_number, 1) == MP_EQ) {
+		mp_clear(&result_number);
+		return BigIntTest{ true, { 0 } };
+	}
+
+	// mp_invmod fails with MP_VAL, if there is no inverse
+	error = mp_invmod(*number, *modulus_number, &result_number);
+
+	if(error == MP_VAL) {
+		mp_clear(&result_number);
+		return std::nullopt;
+	}
+
+	if(error != MP_OKAY) {
+		mp_clear(&result_number);
+		throw std::runtime_error{ mp_error_to_string(error) };
+	}
+
+	BigIntTest result{ false, {} };
+	initialize_bigint_from_tommath(result, std::move(result_number));
+
+	return result;
+}
+
+[[nodiscard]] std::pair<BigIntTest, BigIntTest> BigIntTest::rootrem(uint64_t degree) const {
+
+	// the root functions differ between the supported versions, so the root is found bit by bit,
+	// every bit is kept, if the power isn't bigger than the number
+	const BigIntTest magnitude{ true, this->m_values };
+
+	const size_t bits = ((this->m_values.size() - 1) * 64) +
+	                    static_cast<size_t>(std::bit_width(this->m_values.back()));
+
+	BigIntTest root{ true, { 0 } };
+
+	for(size_t i = (bits + degree - 1) / degree; i != 0; --i) {
+		BigIntTest candidate = root + (BigIntTest{ true, { 1 } } << (i - 1));
+
+		if((magnitude - candidate.pow(degree)).positive()) {
+			root = std::move(candidate);
+		}
+	}
+
+	if(!this->m_positive) {
+		root = BigIntTest{ true, { 0 } } - root;
+	}
+
+	BigIntTest remainder = *this - root.pow(degree);
+
+	return { std::move(root), std::move(remainder) };
+}
+
+[[nodiscard]] BigIntTest BigIntTest::next_prime() const {
+
+	if(!this->m_positive) {
+		return BigIntTest{ true, { 2 } };
+	}
+
+	MPWrapper number = get_tommath_value_from_bigint(*this);
+
+	// the type of the last argument differs between the supported versions, 0 works for both
+	const mp_err error = mp_prime_next_prime(*number, 30, 0);
+	CHECK_MP_ERROR(error);
+
+	mp_int result_number;
+	const mp_err copy_error = mp_init_copy(&result_number, *number);
+	CHECK_MP_ERROR(copy_error);
 
 	BigIntTest result{ false, {} };
 	initialize_bigint_from_tommath(result, std::move(result_number));
@@ -561,4 +1319,67 @@ BigIntTest::BigIntTest(const int64_t& number) : m_values{} {
 	return result;
 }
 
+[[nodiscard]] bool BigIntTest::is_probable_prime() const {
+
+	// the result type of mp_prime_is_prime differs between the supported versions, so this uses
+	// the next prime after this - 1
+	if(!this->m_positive || this->m_values.empty() ||
+	   (this->m_values.size() == 1 && this->m_values[0] < 2)) {
+		return false;
+	}
+
+	const BigIntTest next = (*this - BigIntTest{ true, { 1 } }).next_prime();
+
+	return next.m_values == this->m_values;
+}
+
+// libtommath has no combinatoric functions, so these multiply one factor after another
+
+[[nodiscard]] BigIntTest BigIntTest::factorial(uint64_t number) {
+
+	BigIntTest result{ true, { 1 } };
+
+	for(uint64_t i = 2; i <= number; ++i) {
+		result = result * BigIntTest{ true, { i } };
+	}
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::binomial(uint64_t number, uint64_t count) {
+
+	if(count > number) {
+		return BigIntTest{ true, { 0 } };
+	}
+
+	// every prefix n * ... * (n - i) / (i + 1)! is itself a binomial coefficient, so each
+	// division is exact
+	BigIntTest result{ true, { 1 } };
+
+	for(uint64_t i = 0; i < count; ++i) {
+		result = (result * BigIntTest{ true, { number - i } }) / BigIntTest{ true, { i + 1 } };
+	}
+
+	return result;
+}
+
+[[nodiscard]] BigIntTest BigIntTest::primorial(uint64_t number) {
+
+	BigIntTest result{ true, { 1 } };
+
+	for(uint64_t i = 2; i <= number; ++i) {
+		bool prime = true;
+
+		for(uint64_t divisor = 2; divisor * divisor <= i && prime; ++divisor) {
+			prime = i % divisor != 0;
+		}
+
+		if(prime) {
+			result = result * BigIntTest{ true, { i } };
+		}
+	}
+
+	return result;
+}
+
 #endif
@@ -2,7 +2,9 @@
 
 #include <bigint_c.h>
 
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 struct BigIntTest {
@@ -37,6 +39,59 @@ struct BigIntTest {
 	[[nodiscard]] BigIntTest operator-(const BigIntTest& value2) const;
 
 	[[nodiscard]] BigIntTest operator*(const BigIntTest& value2) const;
+
+	// truncated (rounded towards 0), like in c
+	[[nodiscard]] BigIntTest operator/(const BigIntTest& value2) const;
+
+	// the remainder of the truncated division
+	[[nodiscard]] BigIntTest operator%(const BigIntTest& value2) const;
+
+	// floored (rounded towards negative infinity)
+	[[nodiscard]] BigIntTest div_floor(const BigIntTest& value2) const;
+
+	// the remainder of the floored division
+	[[nodiscard]] BigIntTest mod_floor(const BigIntTest& value2) const;
+
+	[[nodiscard]] BigIntTest operator<<(size_t amount) const;
+
+	// floored (rounded towards negative infinity), like an arithmetic shift
+	[[nodiscard]] BigIntTest operator>>(size_t amount) const;
+
+	// these use the two's complement with infinitely many bits for negative numbers
+	[[nodiscard]] BigIntTest operator&(const BigIntTest& value2) const;
+
+	[[nodiscard]] BigIntTest operator|(const BigIntTest& value2) const;
+
+	[[nodiscard]] BigIntTest operator^(const BigIntTest& value2) const;
+
+	[[nodiscard]] BigIntTest operator~() const;
+
+	[[nodiscard]] BigIntTest pow(uint64_t exponent) const;
+
+	// the result is in [0, |modulus|)
+	[[nodiscard]] BigIntTest powm(const BigIntTest& exponent, const BigIntTest& modulus) const;
+
+	// the gcd of the absolute values
+	[[nodiscard]] BigIntTest gcd(const BigIntTest& value2) const;
+
+	// the inverse in [0, |modulus|), if it exists
+	[[nodiscard]] std::optional<BigIntTest> invert(const BigIntTest& modulus) const;
+
+	// the root rounded towards 0 and the remainder with the sign of this
+	[[nodiscard]] std::pair<BigIntTest, BigIntTest> rootrem(uint64_t degree) const;
+
+	// negative numbers aren't prime
+	[[nodiscard]] bool is_probable_prime() const;
+
+	// the smallest prime, that is bigger than this
+	[[nodiscard]] BigIntTest next_prime() const;
+
+	[[nodiscard]] static BigIntTest factorial(uint64_t number);
+
+	[[nodiscard]] static BigIntTest binomial(uint64_t number, uint64_t count);
+
+	// the product of all primes <= number
+	[[nodiscard]] static BigIntTest primorial(uint64_t number);
 };
 
 struct BigIntDebug {
@@ -48,6 +103,14 @@ struct BigIntDebug {
 // helper thought just for the tests
 [[nodiscard]] bool operator==(const BigInt& value1, const BigIntTest& value2);
 
+// the numbers are in stored order (least significant first)
+[[nodiscard]] BigInt get_big_int_from_numbers(const std::vector<uint64_t>& numbers,
+                                              bool positive = true);
+
+// deterministic pseudo random BigInt with exactly number_count numbers, so that large inputs can
+// be tested without huge string literals
+[[nodiscard]] BigInt get_random_big_int(size_t number_count, uint64_t seed, bool positive = true);
+
 namespace bigint {
 
 [[nodiscard]] bool operator==(const ParseError& error1, const ParseError& error2);
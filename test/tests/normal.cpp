@@ -713,7 +713,12 @@ TEST(BigInt, IntegerToString) {
 		"47812647812641278461278461247812648126478124612461274612841241",
 		std::to_string(std::numeric_limits<uint64_t>::max()),
 		"-384324_132132_3123123_3",
-		"+384324_132132_3123123_3"
+		"+384324_132132_3123123_3",
+		"0",
+		"10000000000000000000",
+		"-9999999999999999999",
+		"100000000000000000000000000000000000000000000000000000000000000000000000000001",
+		"-5000000000000000000000000000000000000070000000000000000000"
 	};
 
 	for(const std::string& test : tests) {
@@ -732,6 +737,16 @@ TEST(BigInt, IntegerToString) {
 			EXPECT_EQ(test, bigint_c_str);
 		}
 	}
+
+	for(const size_t size : { 1, 2, 7, 64, 300 }) {
+		for(const bool positive : { true, false }) {
+
+			const BigInt big_int = get_random_big_int(size, size + 3, positive);
+
+			EXPECT_EQ(big_int.to_string(), BigIntTest(big_int).to_string())
+			    << "Input value: " << BigIntDebug{ big_int };
+		}
+	}
 }
 
 TEST(BigInt, IntegertoHexString) {
@@ -1496,3 +1511,956 @@ TEST(BigInt, IntegerMultiplication) {
 		    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
 	}
 }
+
+TEST(BigInt, IntegerSquaring) {
+
+	std::vector<BigInt> tests{};
+
+	tests.emplace_back((int64_t)0);
+	tests.emplace_back((int64_t)1);
+	tests.emplace_back((int64_t)-1);
+	tests.emplace_back((int64_t)-3);
+	tests.emplace_back(std::numeric_limits<uint64_t>::max());
+	tests.emplace_back(std::numeric_limits<int64_t>::min());
+	tests.emplace_back(
+	    BigInt::get_from_string("-351326324642346363633532562340963427646346346363631").value());
+
+	// sizes around the schoolbook, karatsuba and toom-3 thresholds
+	const std::vector<size_t> sizes{ 2, 3, 5, 17, 63, 64, 65, 100, 199, 200, 201, 250, 700 };
+
+	for(const size_t& size : sizes) {
+		tests.emplace_back(get_random_big_int(size, size));
+		tests.emplace_back(get_random_big_int(size, size + 1, false));
+
+		// all bits set, this has the most carries
+		tests.emplace_back(get_big_int_from_numbers(
+		    std::vector<uint64_t>(size, std::numeric_limits<uint64_t>::max())));
+	}
+
+	for(const BigInt& value : tests) {
+
+		const BigInt actual_result = value * value;
+
+		const BigIntTest result_expected = BigIntTest(value) * BigIntTest(value);
+
+		EXPECT_EQ(actual_result, result_expected) << "Input value: " << BigIntDebug{ value };
+
+		BigInt in_place_value = value.copy();
+		const BigInt& actual_result_in_place = (in_place_value *= in_place_value);
+
+		EXPECT_EQ(actual_result_in_place, result_expected) << "Input value: " << BigIntDebug{ value };
+	}
+}
+
+TEST(BigInt, IntegerMultiplicationUnbalanced) {
+	using TestType = std::tuple<BigInt, BigInt>;
+
+	std::vector<TestType> tests{};
+
+	// pairs of number counts, where one number is much longer than the other one
+	const std::vector<std::pair<size_t, size_t>> sizes{ { 1000, 1 },   { 1000, 3 },
+		                                                { 1000, 31 },  { 1000, 32 },
+		                                                { 1000, 33 },  { 1000, 100 },
+		                                                { 1000, 499 }, { 1000, 500 },
+		                                                { 1001, 500 }, { 2000, 70 } };
+
+	for(const auto& [long_size, short_size] : sizes) {
+		tests.emplace_back(get_random_big_int(long_size, long_size),
+		                   get_random_big_int(short_size, short_size));
+		tests.emplace_back(get_random_big_int(short_size, short_size + 1, false),
+		                   get_random_big_int(long_size, long_size + 1));
+		tests.emplace_back(get_random_big_int(long_size, long_size + 2, false),
+		                   get_random_big_int(short_size, short_size + 2, false));
+	}
+
+	// chunks of the longer number that are completely 0
+	std::vector<uint64_t> sparse_numbers(600, 0ULL);
+	sparse_numbers.front() = 1ULL;
+	sparse_numbers.back() = std::numeric_limits<uint64_t>::max();
+	tests.emplace_back(get_big_int_from_numbers(sparse_numbers), get_random_big_int(40, 40));
+
+	for(const TestType& test : tests) {
+
+		const auto& [value1, value2] = test;
+
+		const BigInt actual_result = value1 * value2;
+
+		const BigIntTest result_expected = BigIntTest(value1) * BigIntTest(value2);
+
+		EXPECT_EQ(actual_result, result_expected)
+		    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+	}
+}
+
+TEST(BigInt, IntegerMixedArithmetic) {
+
+	std::vector<BigInt> values{};
+	values.emplace_back(static_cast<uint64_t>(0ULL));
+	values.emplace_back(static_cast<uint64_t>(1ULL));
+	values.emplace_back(static_cast<int64_t>(-1LL));
+	values.emplace_back(static_cast<uint64_t>(5ULL));
+	values.emplace_back(static_cast<int64_t>(-5LL));
+	values.emplace_back(std::numeric_limits<uint64_t>::max());
+	values.emplace_back(std::numeric_limits<int64_t>::min());
+	values.emplace_back(get_big_int_from_numbers({ 0ULL, 1ULL }));
+	values.emplace_back(get_big_int_from_numbers({ 0ULL, 1ULL }, false));
+	values.emplace_back(get_big_int_from_numbers({ std::numeric_limits<uint64_t>::max(),
+	                                               std::numeric_limits<uint64_t>::max() }));
+	values.emplace_back(get_random_big_int(5, 5));
+	values.emplace_back(get_random_big_int(5, 6, false));
+
+	const std::vector<uint64_t> unsigned_numbers{ 0ULL, 1ULL, 5ULL,
+		                                          std::numeric_limits<uint64_t>::max() };
+
+	const std::vector<int64_t> signed_numbers{ 0LL,
+		                                       1LL,
+		                                       -1LL,
+		                                       5LL,
+		                                       -5LL,
+		                                       std::numeric_limits<int64_t>::max(),
+		                                       std::numeric_limits<int64_t>::min() };
+
+	for(const BigInt& value : values) {
+
+		for(const uint64_t number : unsigned_numbers) {
+			const BigInt number_big_int{ number };
+
+			EXPECT_EQ(value + number, BigIntTest(value) + BigIntTest(number))
+			    << "Input values: " << BigIntDebug{ value } << ", " << number;
+			EXPECT_EQ(value - number, BigIntTest(value) - BigIntTest(number))
+			    << "Input values: " << BigIntDebug{ value } << ", " << number;
+			EXPECT_EQ(value * number, BigIntTest(value) * BigIntTest(number))
+			    << "Input values: " << BigIntDebug{ value } << ", " << number;
+
+			EXPECT_EQ(value == number, value == number_big_int)
+			    << "Input values: " << BigIntDebug{ value } << ", " << number;
+			EXPECT_EQ(value <=> number, value <=> number_big_int)
+			    << "Input values: " << BigIntDebug{ value } << ", " << number;
+		}
+
+		for(const int64_t number : signed_numbers) {
+			const BigInt number_big_int{ number };
+
+			EXPECT_EQ(value + number, BigIntTest(value) + BigIntTest(number))
+			    << "Input values: " << BigIntDebug{ value } << ", " << number;
+			EXPECT_EQ(value - number, BigIntTest(value) - BigIntTest(number))
+			    << "Input values: " << BigIntDebug{ value } << ", " << number;
+			EXPECT_EQ(value * number, BigIntTest(value) * BigIntTest(number))
+			    << "Input values: " << BigIntDebug{ value } << ", " << number;
+
+			EXPECT_EQ(value == number, value == number_big_int)
+			    << "Input values: " << BigIntDebug{ value } << ", " << number;
+			EXPECT_EQ(value <=> number, value <=> number_big_int)
+			    << "Input values: " << BigIntDebug{ value } << ", " << number;
+		}
+	}
+
+	{ // the compound and increment / decrement operators
+		BigInt value{ static_cast<int64_t>(-2LL) };
+
+		const BigInt& added = (value += static_cast<uint64_t>(3ULL));
+		EXPECT_TRUE(added == static_cast<uint64_t>(1ULL));
+
+		const BigInt& multiplied = (value *= static_cast<int64_t>(-7LL));
+		EXPECT_TRUE(multiplied == static_cast<int64_t>(-7LL));
+
+		const BigInt& subtracted = (value -= static_cast<int64_t>(-8LL));
+		EXPECT_TRUE(subtracted == static_cast<uint64_t>(1ULL));
+
+		const BigInt old_value = value--;
+		EXPECT_TRUE(old_value == static_cast<uint64_t>(1ULL));
+		EXPECT_TRUE(value == static_cast<uint64_t>(0ULL));
+
+		const BigInt& decremented = --value;
+		EXPECT_TRUE(decremented == static_cast<int64_t>(-1LL));
+
+		const BigInt& incremented = ++value;
+		// this also checks, that the result is +0 and not -0
+		EXPECT_EQ(incremented, BigIntTest(static_cast<uint64_t>(0ULL)));
+	}
+
+	{ // plain literals, that are neither uint64_t nor int64_t
+		BigInt value{ static_cast<int64_t>(-2LL) };
+
+		EXPECT_EQ(value + 1, BigIntTest(static_cast<int64_t>(-1LL)));
+		EXPECT_EQ(value - 1, BigIntTest(static_cast<int64_t>(-3LL)));
+		EXPECT_EQ(value * 10, BigIntTest(static_cast<int64_t>(-20LL)));
+		EXPECT_EQ(value * -10, BigIntTest(static_cast<uint64_t>(20ULL)));
+		EXPECT_EQ(value + 5U, BigIntTest(static_cast<uint64_t>(3ULL)));
+		EXPECT_EQ(value * 3LL, BigIntTest(static_cast<int64_t>(-6LL)));
+
+		EXPECT_FALSE(value == 0);
+		EXPECT_TRUE(value == -2);
+		EXPECT_TRUE(value != 2);
+		EXPECT_TRUE(-2 == value);
+		EXPECT_TRUE(value < 0);
+		EXPECT_TRUE(value >= -2LL);
+		EXPECT_TRUE(value < 1U);
+		EXPECT_EQ(value <=> -3, std::strong_ordering::greater);
+
+		const BigInt& added = (value += 2);
+		EXPECT_TRUE(added == 0);
+
+		const BigInt& multiplied = (value -= 4) *= -3;
+		EXPECT_TRUE(multiplied == 12);
+	}
+}
+
+TEST(BigInt, IntegerAdditionMixedSigns) {
+	using TestType = std::tuple<BigInt, BigInt>;
+
+	std::vector<TestType> tests{};
+
+	constexpr uint64_t max = std::numeric_limits<uint64_t>::max();
+
+	// the top numbers are the same and cancel each other out
+	std::vector<uint64_t> numbers1{ 5ULL, 7ULL, 0x1234ULL, 0x5678ULL };
+	std::vector<uint64_t> numbers2{ 9ULL, 6ULL, 0x1234ULL, 0x5678ULL };
+	std::vector<uint64_t> numbers3{ 9ULL, 7ULL, 0x1234ULL, 0x5678ULL };
+
+	for(const bool positive1 : { true, false }) {
+		for(const bool positive2 : { true, false }) {
+			tests.emplace_back(get_big_int_from_numbers(numbers1, positive1),
+			                   get_big_int_from_numbers(numbers2, positive2));
+			tests.emplace_back(get_big_int_from_numbers(numbers2, positive1),
+			                   get_big_int_from_numbers(numbers1, positive2));
+			tests.emplace_back(get_big_int_from_numbers(numbers1, positive1),
+			                   get_big_int_from_numbers(numbers3, positive2));
+			tests.emplace_back(get_big_int_from_numbers(numbers1, positive1),
+			                   get_big_int_from_numbers(numbers1, positive2));
+
+			// the carry / borrow goes through all numbers
+			tests.emplace_back(get_big_int_from_numbers({ max, max, max }, positive1),
+			                   get_big_int_from_numbers({ 1ULL }, positive2));
+			tests.emplace_back(get_big_int_from_numbers({ 0ULL, 0ULL, 1ULL }, positive1),
+			                   get_big_int_from_numbers({ 1ULL }, positive2));
+
+			tests.emplace_back(get_random_big_int(40, 40, positive1),
+			                   get_random_big_int(39, 39, positive2));
+		}
+	}
+
+	for(const TestType& test : tests) {
+
+		const auto& [value1, value2] = test;
+
+		EXPECT_EQ(value1 + value2, BigIntTest(value1) + BigIntTest(value2))
+		    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+
+		EXPECT_EQ(value1 - value2, BigIntTest(value1) - BigIntTest(value2))
+		    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+	}
+}
+
+TEST(BigInt, IntegerDivision) {
+	using TestType = std::tuple<BigInt, BigInt>;
+
+	std::vector<TestType> tests{};
+
+	constexpr uint64_t max = std::numeric_limits<uint64_t>::max();
+
+	// pairs of number counts for dividend and divisor
+	const std::vector<std::pair<size_t, size_t>> sizes{ { 1, 1 },  { 2, 1 },   { 5, 1 },
+		                                                { 2, 2 },  { 3, 2 },   { 10, 3 },
+		                                                { 50, 20 }, { 100, 99 }, { 200, 50 },
+		                                                { 300, 100 }, { 1000, 400 }, { 800, 61 },
+		                                                { 2000, 1000 }, { 1500, 130 } };
+
+	for(const bool positive1 : { true, false }) {
+		for(const bool positive2 : { true, false }) {
+
+			for(const auto& [dividend_size, divisor_size] : sizes) {
+				tests.emplace_back(
+				    get_random_big_int(dividend_size, dividend_size * 3, positive1),
+				    get_random_big_int(divisor_size, (divisor_size * 5) + 1, positive2));
+			}
+
+			// the dividend is smaller than the divisor
+			tests.emplace_back(get_random_big_int(3, 3, positive1),
+			                   get_random_big_int(4, 4, positive2));
+
+			// exact divisions
+			tests.emplace_back(get_big_int_from_numbers({ 0ULL, 0ULL, 1ULL }, positive1),
+			                   get_big_int_from_numbers({ 0ULL, 1ULL }, positive2));
+			tests.emplace_back(get_big_int_from_numbers({ 6ULL }, positive1),
+			                   get_big_int_from_numbers({ 3ULL }, positive2));
+
+			// the divisor is already normalized, or needs the maximum shift
+			tests.emplace_back(get_random_big_int(6, 7, positive1),
+			                   get_big_int_from_numbers({ 5ULL, max }, positive2));
+			tests.emplace_back(get_random_big_int(6, 8, positive1),
+			                   get_big_int_from_numbers({ max, 1ULL }, positive2));
+			tests.emplace_back(get_random_big_int(6, 9, positive1),
+			                   get_big_int_from_numbers({ 1ULL }, positive2));
+
+			// the top numbers are the same, so that the quotient estimate is 2^64 - 1
+			tests.emplace_back(
+			    get_big_int_from_numbers({ 0ULL, max - 1, 0x8000000000000000ULL }, positive1),
+			    get_big_int_from_numbers({ max, 0x8000000000000000ULL }, positive2));
+			tests.emplace_back(get_big_int_from_numbers({ max, max, max, max }, positive1),
+			                   get_big_int_from_numbers({ max, max }, positive2));
+
+			// the quotient has all bits set and the divisor is big enough for the recursive
+			// division, so the lower half of the quotient has to borrow from its top number
+			for(const auto& [quotient_size, divisor_size] :
+			    std::vector<std::pair<size_t, size_t>>{ { 119, 87 }, { 200, 150 }, { 64, 60 } }) {
+				const BigInt divisor =
+				    get_random_big_int(divisor_size, (divisor_size * 7) + 2, positive2);
+				const BigInt quotient = get_big_int_from_numbers(
+				    std::vector<uint64_t>(quotient_size, max), positive1 == positive2);
+
+				tests.emplace_back(quotient * divisor, divisor.copy());
+				tests.emplace_back((quotient * divisor) +
+				                       get_random_big_int(divisor_size - 1, divisor_size, positive2),
+				                   divisor.copy());
+			}
+		}
+	}
+
+	for(const TestType& test : tests) {
+
+		const auto& [value1, value2] = test;
+
+		const BigIntTest expected_quotient = BigIntTest(value1) / BigIntTest(value2);
+		const BigIntTest expected_remainder = BigIntTest(value1) % BigIntTest(value2);
+
+		EXPECT_EQ(value1 / value2, expected_quotient)
+		    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+		EXPECT_EQ(value1 % value2, expected_remainder)
+		    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+
+		const auto [quotient, remainder] = value1.divmod(value2);
+		EXPECT_EQ(quotient, expected_quotient)
+		    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+		EXPECT_EQ(remainder, expected_remainder)
+		    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+
+		const auto [quotient_floor, remainder_floor] = value1.divmod_floor(value2);
+		EXPECT_EQ(quotient_floor, BigIntTest(value1).div_floor(BigIntTest(value2)))
+		    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+		EXPECT_EQ(remainder_floor, BigIntTest(value1).mod_floor(BigIntTest(value2)))
+		    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+	}
+
+	{ // the compound operators
+		BigInt value{ static_cast<int64_t>(-17LL) };
+
+		const BigInt& divided = (value /= BigInt{ static_cast<uint64_t>(5ULL) });
+		EXPECT_EQ(divided, BigIntTest(static_cast<int64_t>(-3LL)));
+
+		const BigInt& remainder = (value %= BigInt{ static_cast<uint64_t>(2ULL) });
+		EXPECT_EQ(remainder, BigIntTest(static_cast<int64_t>(-1LL)));
+	}
+
+	EXPECT_THROW(
+	    {
+		    const BigInt result =
+		        BigInt{ static_cast<uint64_t>(1ULL) } / BigInt{ static_cast<uint64_t>(0ULL) };
+		    UNUSED(result);
+	    },
+	    std::domain_error);
+}
+
+TEST(BigInt, IntegerReciprocal) {
+	using TestType = std::tuple<BigInt, size_t>;
+
+	std::vector<TestType> tests{};
+
+	// pairs of the number count of the value and the bits, the bigger ones need newton steps
+	const std::vector<std::pair<size_t, size_t>> sizes{
+		{ 1, 0 },     { 1, 63 },     { 1, 200 },     { 3, 100 },   { 3, 1000 },
+		{ 20, 1280 }, { 70, 10000 }, { 200, 30000 }, { 150, 9601 },
+	};
+
+	for(const bool positive : { true, false }) {
+		for(const auto& [size, bits] : sizes) {
+			tests.emplace_back(get_random_big_int(size, (size * 7) + bits, positive), bits);
+		}
+
+		// 2^bits is less than the value
+		tests.emplace_back(get_random_big_int(4, 11, positive), 100);
+
+		// the value is a power of two, so the reciprocal is exact
+		tests.emplace_back(get_big_int_from_numbers({ 0ULL, 0ULL, 1ULL }, positive), 5000);
+	}
+
+	for(const TestType& test : tests) {
+
+		const auto& [value, bits] = test;
+
+		std::vector<uint64_t> power_numbers((bits / 64) + 1, 0ULL);
+		power_numbers.back() = 1ULL << (bits % 64);
+
+		const BigInt power = get_big_int_from_numbers(power_numbers);
+
+		EXPECT_EQ(value.reciprocal(bits), BigIntTest(power) / BigIntTest(value))
+		    << "Input values: " << BigIntDebug{ value } << ", " << bits;
+	}
+
+	EXPECT_THROW(
+	    {
+		    const BigInt result = BigInt{ static_cast<uint64_t>(0ULL) }.reciprocal(64);
+		    UNUSED(result);
+	    },
+	    std::domain_error);
+}
+
+TEST(BigInt, IntegerDivisionExact) {
+	using TestType = std::tuple<BigInt, BigInt>;
+
+	std::vector<TestType> tests{};
+
+	// pairs of number counts for quotient and divisor
+	const std::vector<std::pair<size_t, size_t>> sizes{ { 1, 1 },    { 1, 2 },    { 5, 2 },
+		                                                { 3, 10 },   { 20, 20 },  { 100, 3 },
+		                                                { 70, 150 }, { 400, 300 }, { 850, 900 },
+		                                                { 820, 2000 } };
+
+	for(const bool positive1 : { true, false }) {
+		for(const bool positive2 : { true, false }) {
+
+			for(const auto& [quotient_size, divisor_size] : sizes) {
+
+				const auto get_divisor = [&divisor_size, &positive2]() -> BigInt {
+					return get_random_big_int(divisor_size, (divisor_size * 5) + 2, positive2);
+				};
+
+				tests.emplace_back(
+				    get_random_big_int(quotient_size, quotient_size * 3, positive1) * get_divisor(),
+				    get_divisor());
+			}
+
+			// divisors with factors of two, also whole numbers of zeroes
+			const auto get_even_divisor = [&positive2]() -> BigInt {
+				return get_big_int_from_numbers({ 0ULL, 0x30ULL, 0x05ULL }, positive2);
+			};
+			const auto get_power_divisor = [&positive2]() -> BigInt {
+				return get_big_int_from_numbers({ 0ULL, 0ULL, 0x08ULL }, positive2);
+			};
+
+			tests.emplace_back(get_random_big_int(7, 13, positive1) * get_even_divisor(),
+			                   get_even_divisor());
+			tests.emplace_back(get_random_big_int(7, 14, positive1) * get_power_divisor(),
+			                   get_power_divisor());
+
+			// the dividend is 0
+			tests.emplace_back(BigInt{ static_cast<uint64_t>(0ULL) }, get_even_divisor());
+		}
+	}
+
+	for(const TestType& test : tests) {
+
+		const auto& [value1, value2] = test;
+
+		EXPECT_EQ(value1.divexact(value2), BigIntTest(value1) / BigIntTest(value2))
+		    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+	}
+
+	for(const uint64_t divisor :
+	    { 1ULL, 3ULL, 0x40ULL, 0x7000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL }) {
+		for(const bool positive : { true, false }) {
+
+			const BigInt value = get_random_big_int(9, divisor % 1000, positive) *
+			                     BigInt{ static_cast<uint64_t>(divisor) };
+
+			EXPECT_EQ(value.divexact(divisor),
+			          BigIntTest(value) / BigIntTest(static_cast<uint64_t>(divisor)))
+			    << "Input values: " << BigIntDebug{ value } << ", " << divisor;
+		}
+	}
+
+	EXPECT_THROW(
+	    {
+		    const BigInt result = BigInt{ static_cast<uint64_t>(1ULL) }.divexact(0ULL);
+		    UNUSED(result);
+	    },
+	    std::domain_error);
+}
+
+TEST(BigInt, IntegerShift) {
+
+	// amounts below one number, exactly one number and across several numbers
+	const std::vector<size_t> amounts{ 0, 1, 5, 63, 64, 65, 128, 200, 1000 };
+
+	std::vector<BigInt> tests{};
+
+	for(const bool positive : { true, false }) {
+		for(const size_t size : { 1, 2, 3, 10 }) {
+			tests.push_back(get_random_big_int(size, size * 11, positive));
+		}
+
+		// the shifted out bits are all 0, so no rounding is needed for negative numbers
+		tests.push_back(get_big_int_from_numbers({ 0ULL, 0ULL, 0x10ULL }, positive));
+
+		// all ones, the rounding carries through all numbers
+		tests.push_back(get_big_int_from_numbers(
+		    { 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL }, positive));
+
+		tests.push_back(get_big_int_from_numbers({ 0x01ULL }, positive));
+	}
+
+	tests.emplace_back(static_cast<uint64_t>(0ULL));
+
+	for(const BigInt& value : tests) {
+		for(const size_t amount : amounts) {
+
+			EXPECT_EQ(value << amount, BigIntTest(value) << amount)
+			    << "Input values: " << BigIntDebug{ value } << ", " << amount;
+			EXPECT_EQ(value >> amount, BigIntTest(value) >> amount)
+			    << "Input values: " << BigIntDebug{ value } << ", " << amount;
+
+			{ // the in place variants
+				BigInt shifted_left = value.copy();
+				const BigInt& shifted_left_result = (shifted_left <<= amount);
+				EXPECT_EQ(shifted_left_result, BigIntTest(value) << amount)
+				    << "Input values: " << BigIntDebug{ value } << ", " << amount;
+
+				BigInt shifted_right = value.copy();
+				const BigInt& shifted_right_result = (shifted_right >>= amount);
+				EXPECT_EQ(shifted_right_result, BigIntTest(value) >> amount)
+				    << "Input values: " << BigIntDebug{ value } << ", " << amount;
+			}
+		}
+	}
+}
+
+TEST(BigInt, IntegerBitwise) {
+
+	std::vector<BigInt> tests{};
+
+	for(const bool positive : { true, false }) {
+		for(const size_t size : { 1, 2, 3, 10 }) {
+			tests.push_back(get_random_big_int(size, size * 13, positive));
+		}
+
+		// the lowest numbers are 0, so the two's complement of them is 0 as well
+		tests.push_back(get_big_int_from_numbers({ 0ULL, 0ULL, 0x10ULL }, positive));
+
+		// all ones, the two's complement of the negative one has a carry into a new number
+		tests.push_back(get_big_int_from_numbers(
+		    { 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL }, positive));
+
+		tests.push_back(get_big_int_from_numbers({ 0x01ULL }, positive));
+
+		tests.push_back(get_big_int_from_numbers({ 0x01ULL, 0x8000000000000000ULL }, positive));
+	}
+
+	tests.emplace_back(static_cast<uint64_t>(0ULL));
+
+	for(const BigInt& value1 : tests) {
+
+		EXPECT_EQ(~value1, ~BigIntTest(value1)) << "Input value: " << BigIntDebug{ value1 };
+
+		for(const BigInt& value2 : tests) {
+
+			const BigIntTest test1{ value1 };
+			const BigIntTest test2{ value2 };
+
+			EXPECT_EQ(value1 & value2, test1 & test2)
+			    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+			EXPECT_EQ(value1 | value2, test1 | test2)
+			    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+			EXPECT_EQ(value1 ^ value2, test1 ^ test2)
+			    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+
+			{ // the in place variants
+				BigInt and_value = value1.copy();
+				const BigInt& and_result = (and_value &= value2);
+				EXPECT_EQ(and_result, test1 & test2)
+				    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+
+				BigInt or_value = value1.copy();
+				const BigInt& or_result = (or_value |= value2);
+				EXPECT_EQ(or_result, test1 | test2)
+				    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+
+				BigInt xor_value = value1.copy();
+				const BigInt& xor_result = (xor_value ^= value2);
+				EXPECT_EQ(xor_result, test1 ^ test2)
+				    << "Input values: " << BigIntDebug{ value1 } << ", " << BigIntDebug{ value2 };
+			}
+		}
+	}
+}
+
+TEST(BigInt, IntegerBitManipulation) {
+
+	const std::vector<size_t> indices{ 0, 1, 63, 64, 65, 127, 128, 200, 1000 };
+
+	std::vector<BigInt> tests{};
+
+	for(const bool positive : { true, false }) {
+		for(const size_t size : { 1, 2, 3, 10 }) {
+			tests.push_back(get_random_big_int(size, size * 17, positive));
+		}
+
+		tests.push_back(get_big_int_from_numbers({ 0ULL, 0ULL, 0x10ULL }, positive));
+
+		// all ones, setting a bit of the negative one carries into a new number
+		tests.push_back(get_big_int_from_numbers(
+		    { 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL }, positive));
+
+		tests.push_back(get_big_int_from_numbers({ 0x01ULL }, positive));
+	}
+
+	tests.emplace_back(static_cast<uint64_t>(0ULL));
+
+	for(const BigInt& value : tests) {
+
+		const BigIntTest test_value{ value };
+
+		{ // the bit counts of the absolute value
+			BigInt copied = value.copy();
+			const BigInt& absolute = test_value.positive() ? copied : -copied;
+
+			const size_t bit_length = value.bit_length();
+
+			EXPECT_EQ(absolute >> bit_length, BigInt(static_cast<uint64_t>(0ULL)))
+			    << "Input value: " << BigIntDebug{ value };
+
+			size_t popcount = 0;
+			for(size_t i = 0; i < bit_length; ++i) {
+				popcount += absolute.test_bit(i) ? 1 : 0;
+			}
+
+			EXPECT_EQ(value.popcount(), popcount) << "Input value: " << BigIntDebug{ value };
+
+			if(bit_length != 0) {
+				EXPECT_TRUE(absolute.test_bit(bit_length - 1))
+				    << "Input value: " << BigIntDebug{ value };
+
+				const size_t ctz = value.ctz();
+				EXPECT_TRUE(value.test_bit(ctz)) << "Input value: " << BigIntDebug{ value };
+				EXPECT_EQ((value >> ctz) << ctz, value) << "Input value: " << BigIntDebug{ value };
+				EXPECT_NE((value >> (ctz + 1)) << (ctz + 1), value)
+				    << "Input value: " << BigIntDebug{ value };
+			} else {
+				EXPECT_EQ(value.ctz(), 0ULL);
+				EXPECT_EQ(value.popcount(), 0ULL);
+			}
+		}
+
+		for(const size_t index : indices) {
+
+			const BigIntTest bit = BigIntTest(static_cast<uint64_t>(1ULL)) << index;
+
+			EXPECT_EQ(value.test_bit(index), (test_value & bit).to_string() == bit.to_string())
+			    << "Input values: " << BigIntDebug{ value } << ", " << index;
+
+			BigInt set_value = value.copy();
+			set_value.set_bit(index);
+			EXPECT_EQ(set_value, test_value | bit)
+			    << "Input values: " << BigIntDebug{ value } << ", " << index;
+
+			BigInt cleared_value = value.copy();
+			cleared_value.clear_bit(index);
+			EXPECT_EQ(cleared_value, test_value & (~bit))
+			    << "Input values: " << BigIntDebug{ value } << ", " << index;
+		}
+	}
+
+	EXPECT_EQ(BigInt(static_cast<uint64_t>(0ULL)).bit_length(), 0ULL);
+	EXPECT_EQ(BigInt(static_cast<uint64_t>(0x10ULL)).bit_length(), 5ULL);
+	EXPECT_EQ(BigInt(static_cast<int64_t>(-0x10LL)).bit_length(), 5ULL);
+	EXPECT_EQ(BigInt(static_cast<int64_t>(-0x10LL)).ctz(), 4ULL);
+	EXPECT_EQ(get_big_int_from_numbers({ 0x03ULL, 0xFFULL }, false).popcount(), 10ULL);
+}
+
+TEST(BigInt, IntegerPow) {
+
+	// these cover all window sizes and runs of zeroes in the exponent
+	const std::vector<uint64_t> exponents{ 0, 1, 2, 3, 5, 16, 17, 63, 100, 255, 1000, 0x2001 };
+
+	std::vector<BigInt> tests{};
+
+	for(const bool positive : { true, false }) {
+		for(const size_t size : { 1, 2, 3 }) {
+			tests.push_back(get_random_big_int(size, size * 19, positive));
+		}
+
+		// powers of two and numbers with a power of two factor
+		tests.push_back(get_big_int_from_numbers({ 0ULL, 0x10ULL }, positive));
+		tests.push_back(get_big_int_from_numbers({ 0x0C00ULL }, positive));
+
+		tests.push_back(get_big_int_from_numbers({ 0x01ULL }, positive));
+		tests.push_back(get_big_int_from_numbers({ 0x03ULL }, positive));
+		tests.push_back(get_big_int_from_numbers({ 0xFFFFFFFFFFFFFFFFULL }, positive));
+	}
+
+	tests.emplace_back(static_cast<uint64_t>(0ULL));
+
+	for(const BigInt& value : tests) {
+		for(const uint64_t exponent : exponents) {
+
+			// keep the results at a reasonable size
+			if(value.bit_length() * exponent > 200000) {
+				continue;
+			}
+
+			EXPECT_EQ(value.pow(exponent), BigIntTest(value).pow(exponent))
+			    << "Input values: " << BigIntDebug{ value } << ", " << exponent;
+		}
+	}
+
+	{ // large enough for the toom-3 squaring
+		const BigInt value = get_random_big_int(120, 1234, false);
+
+		EXPECT_EQ(value.pow(7), BigIntTest(value).pow(7));
+	}
+}
+
+TEST(BigInt, IntegerPowMod) {
+
+	std::vector<BigInt> moduli{};
+
+	for(const size_t size : { 1, 2, 5, 32, 40, 64 }) {
+		// odd moduli, including the sizes of 2048 and 4096 bit keys
+		BigInt modulus = get_random_big_int(size, size * 23, true);
+		modulus.set_bit(0);
+		moduli.push_back(std::move(modulus));
+	}
+
+	// even moduli don't use montgomery arithmetic
+	moduli.push_back(get_big_int_from_numbers({ 0x1234ULL, 0x42ULL }, true));
+	moduli.push_back(get_big_int_from_numbers({ 0x01ULL }, true));
+	moduli.push_back(get_big_int_from_numbers({ 0x07ULL }, false));
+
+	for(const BigInt& modulus : moduli) {
+
+		const size_t size = modulus.bit_length() / 64 + 1;
+
+		for(const bool positive : { true, false }) {
+			// the base can be greater than the modulus
+			for(const size_t base_size : { size_t{ 1 }, size, size + 3 }) {
+
+				const BigInt base = get_random_big_int(base_size, base_size * 29, positive);
+
+				for(const size_t exponent_size : { 1, 2, 5 }) {
+
+					const BigInt exponent = get_random_big_int(exponent_size, exponent_size * 31);
+
+					EXPECT_EQ(base.powm(exponent, modulus),
+					          BigIntTest(base).powm(BigIntTest(exponent), BigIntTest(modulus)))
+					    << "Input values: " << BigIntDebug{ base } << ", "
+					    << BigIntDebug{ exponent } << ", " << BigIntDebug{ modulus };
+				}
+
+				for(const uint64_t small_exponent : { 0ULL, 1ULL, 2ULL, 0x100ULL }) {
+
+					const BigInt exponent{ small_exponent };
+
+					EXPECT_EQ(base.powm(exponent, modulus),
+					          BigIntTest(base).powm(BigIntTest(exponent), BigIntTest(modulus)))
+					    << "Input values: " << BigIntDebug{ base } << ", "
+					    << BigIntDebug{ exponent } << ", " << BigIntDebug{ modulus };
+				}
+			}
+		}
+	}
+}
+
+TEST(BigInt, IntegerGcd) {
+
+	std::vector<std::pair<BigInt, BigInt>> tests{};
+
+	// binary gcd, lehmer steps and division steps for very different sizes
+	for(const size_t size1 : { 1, 2, 3, 8, 40 }) {
+		for(const size_t size2 : { 1, 2, 5, 40 }) {
+			for(const bool positive : { true, false }) {
+				tests.emplace_back(get_random_big_int(size1, (size1 * 53) + size2, positive),
+				                   get_random_big_int(size2, (size2 * 59) + size1));
+			}
+		}
+	}
+
+	// with a big common factor
+	for(const size_t size : { 1, 4, 20 }) {
+		const BigInt factor = get_random_big_int(size, size * 61);
+
+		tests.emplace_back(get_random_big_int(size + 2, size * 67) * factor,
+		                   get_random_big_int(size + 1, size * 71, false) * factor);
+	}
+
+	// the half gcd, above the thresholds of the gcd with and without cofactors
+	for(const size_t size : { 300, 1100 }) {
+		const BigInt factor = get_random_big_int(size / 3, size * 83);
+
+		tests.emplace_back(get_random_big_int(size, size * 89),
+		                   get_random_big_int(size - 7, size * 97, false));
+		tests.emplace_back(get_random_big_int(size - (size / 3), size * 101) * factor,
+		                   get_random_big_int(size - (size / 3), size * 103) * factor);
+		tests.emplace_back(get_random_big_int(size, size * 107), get_random_big_int(40, size));
+	}
+
+	tests.emplace_back(BigInt{ uint64_t{ 0 } }, get_random_big_int(2, 73, false));
+	tests.emplace_back(get_random_big_int(3, 79), BigInt{ uint64_t{ 0 } });
+	tests.emplace_back(BigInt{ uint64_t{ 0 } }, BigInt{ uint64_t{ 0 } });
+	tests.emplace_back(BigInt{ uint64_t{ 12 } }, BigInt{ uint64_t{ 1 } });
+
+	for(const auto& [big_int1, big_int2] : tests) {
+
+		const BigIntTest expected = BigIntTest(big_int1).gcd(BigIntTest(big_int2));
+
+		EXPECT_EQ(big_int1.gcd(big_int2), expected)
+		    << "Input values: " << BigIntDebug{ big_int1 } << ", " << BigIntDebug{ big_int2 };
+
+		const auto [gcd, factor1, factor2] = big_int1.gcdext(big_int2);
+
+		EXPECT_EQ(gcd, expected);
+		EXPECT_EQ(big_int1 * factor1 + big_int2 * factor2, gcd)
+		    << "Input values: " << BigIntDebug{ big_int1 } << ", " << BigIntDebug{ big_int2 };
+
+		if(big_int2 == uint64_t{ 0 }) {
+			continue;
+		}
+
+		const std::optional<BigInt> inverse = big_int1.invert(big_int2);
+		const std::optional<BigIntTest> expected_inverse =
+		    BigIntTest(big_int1).invert(BigIntTest(big_int2));
+
+		ASSERT_EQ(inverse.has_value(), expected_inverse.has_value())
+		    << "Input values: " << BigIntDebug{ big_int1 } << ", " << BigIntDebug{ big_int2 };
+
+		if(inverse.has_value()) {
+			EXPECT_EQ(inverse.value(), expected_inverse.value());
+		}
+	}
+}
+
+TEST(BigInt, IntegerRoots) {
+
+	std::vector<BigInt> tests{};
+
+	// the base cases and a few recursion levels of both roots
+	for(const size_t size : { 1, 2, 3, 10, 41, 100 }) {
+		tests.push_back(get_random_big_int(size, size * 109));
+		tests.push_back(get_random_big_int(size, size * 113, false));
+	}
+
+	// perfect powers and their neighbours, where the remainders are 0 or the largest possible
+	for(const uint64_t degree : { 2, 3, 7 }) {
+		BigInt power = get_random_big_int(5, degree * 127).pow(degree);
+
+		tests.push_back(power - BigInt{ uint64_t{ 1 } });
+		tests.push_back(power + BigInt{ uint64_t{ 1 } });
+		tests.push_back(std::move(power));
+	}
+
+	for(const uint64_t value : { 0, 1, 2, 3, 4, 8, 9 }) {
+		tests.emplace_back(value);
+	}
+
+	tests.emplace_back(std::numeric_limits<uint64_t>::max());
+
+	for(const BigInt& big_int : tests) {
+
+		const bool negative = big_int < BigInt{ uint64_t{ 0 } };
+
+		if(!negative) {
+			const auto [expected_root, expected_remainder] = BigIntTest(big_int).rootrem(2);
+			const auto [root, remainder] = big_int.sqrtrem();
+
+			EXPECT_EQ(root, expected_root) << "Input value: " << BigIntDebug{ big_int };
+			EXPECT_EQ(remainder, expected_remainder) << "Input value: " << BigIntDebug{ big_int };
+		}
+
+		for(const uint64_t degree : { 1, 2, 3, 5, 7, 64, 100 }) {
+
+			if(negative && (degree & 0x01) == 0) {
+				continue;
+			}
+
+			const auto [expected_root, expected_remainder] = BigIntTest(big_int).rootrem(degree);
+			const auto [root, remainder] = big_int.rootrem(degree);
+
+			EXPECT_EQ(root, expected_root)
+			    << "Input value: " << BigIntDebug{ big_int } << ", degree: " << degree;
+			EXPECT_EQ(remainder, expected_remainder)
+			    << "Input value: " << BigIntDebug{ big_int } << ", degree: " << degree;
+		}
+	}
+}
+
+TEST(BigInt, IntegerPrimes) {
+
+	std::vector<BigInt> tests{};
+
+	// the trial division, the baillie psw test and the sieve of the next prime, for numbers with
+	// and without a small factor
+	for(const size_t size : { 1, 2, 4, 9, 17 }) {
+		BigInt big_int = get_random_big_int(size, size * 131);
+
+		BigInt prime = big_int.next_prime();
+
+		tests.push_back(prime * get_random_big_int(1, size * 137));
+		tests.push_back(prime + BigInt{ uint64_t{ 2 } });
+		tests.push_back(std::move(prime));
+		tests.push_back(std::move(big_int));
+	}
+
+	// squares without a small factor, 1093^2 is a strong pseudoprime to the base 2
+	const BigInt square_root = get_random_big_int(3, 139).next_prime();
+	tests.push_back(square_root * square_root);
+	tests.emplace_back(uint64_t{ 1194649 });
+
+	for(const uint64_t value : { 0, 1, 2, 3, 4, 9, 1021, 1023, 1048573, 1048583 }) {
+		tests.emplace_back(value);
+	}
+
+	tests.push_back(get_random_big_int(2, 149, false));
+
+	for(const BigInt& big_int : tests) {
+
+		const BigIntTest expected = BigIntTest(big_int);
+
+		EXPECT_EQ(big_int.is_probable_prime(), expected.is_probable_prime())
+		    << "Input value: " << BigIntDebug{ big_int };
+		EXPECT_EQ(big_int.is_probable_prime(2), expected.is_probable_prime())
+		    << "Input value: " << BigIntDebug{ big_int };
+
+		const BigIntTest expected_next = expected.next_prime();
+
+		EXPECT_EQ(big_int.next_prime(), expected_next) << "Input value: " << BigIntDebug{ big_int };
+		EXPECT_EQ(big_int.next_prime(4), expected_next)
+		    << "Input value: " << BigIntDebug{ big_int };
+	}
+
+	// more numbers than the product of the small primes, so the trial division first takes one
+	// remainder of it, the next prime of these takes too long
+	const BigInt big_prime = get_random_big_int(17, 151).next_prime();
+
+	for(const BigInt& big_int : { big_prime * big_prime, big_prime * get_random_big_int(17, 157),
+	                             get_random_big_int(34, 163), get_random_big_int(40, 167) }) {
+
+		EXPECT_EQ(big_int.is_probable_prime(), BigIntTest(big_int).is_probable_prime())
+		    << "Input value: " << BigIntDebug{ big_int };
+	}
+}
+
+TEST(BigInt, IntegerCombinatorics) {
+
+	// the numbers, that fit into one number, a few levels of the prime swing and product trees
+	// with more than one level
+	for(const uint64_t number : { 0, 1, 2, 3, 20, 21, 100, 777, 5000 }) {
+
+		EXPECT_EQ(BigInt::factorial(number), BigIntTest::factorial(number))
+		    << "Input value: " << number;
+		EXPECT_EQ(BigInt::primorial(number), BigIntTest::primorial(number))
+		    << "Input value: " << number;
+
+		// the product of the top factors for small k and the prime factorization for big k
+		for(const uint64_t count : { uint64_t{ 0 }, uint64_t{ 1 }, uint64_t{ 2 }, number / 100,
+		                             number / 3, number / 2, number, number + 1 }) {
+
+			EXPECT_EQ(BigInt::binomial(number, count), BigIntTest::binomial(number, count))
+			    << "Input values: " << number << ", " << count;
+		}
+	}
+
+	for(const uint64_t count : { 0, 1, 7, 30 }) {
+		const uint64_t number = std::numeric_limits<uint64_t>::max() - count;
+
+		EXPECT_EQ(BigInt::binomial(number, count), BigIntTest::binomial(number, count))
+		    << "Input values: " << number << ", " << count;
+	}
+}
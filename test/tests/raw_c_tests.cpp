@@ -8,6 +8,29 @@
 #include "../helper/matcher.hpp"
 #include "../helper/printer.hpp"
 
+#include <random>
+#include <utility>
+#include <vector>
+
+// deterministic pseudo random BigIntC, the caller has to free it
+static BigIntC random_bigint_c(size_t count, uint64_t seed, bool positive) {
+	std::mt19937_64 generator{ seed };
+
+	// the most significant number comes first
+	std::vector<uint64_t> numbers{};
+	for(size_t i = 0; i < count; ++i) {
+		numbers.push_back(generator());
+	}
+
+	BigIntC result = bigint_from_list_of_numbers(numbers.data(), numbers.size());
+
+	if(!positive) {
+		bigint_negate(&result);
+	}
+
+	return result;
+}
+
 TEST(BigIntCFuncs, FreeAllowsNull) {
 
 	free_bigint(nullptr);
@@ -63,6 +86,552 @@ TEST(BigIntCFuncs, BinStrReturnsNullOnInvalidInput) {
 	EXPECT_EQ(str, nullptr);
 }
 
+TEST(BigIntCFuncs, MulDetectsSquaring) {
+
+	const uint64_t numbers[] = { 0x1234ULL, 0xFFFFFFFFFFFFFFFFULL, 0x42ULL };
+
+	BigIntC big_int_c = bigint_from_list_of_numbers(numbers, 3);
+
+	BigIntC other_c = bigint_copy(big_int_c);
+
+	BigIntC squared = bigint_sqr(big_int_c);
+	BigIntC aliased = bigint_mul_bigint(big_int_c, big_int_c);
+	BigIntC not_aliased = bigint_mul_bigint(big_int_c, other_c);
+
+	EXPECT_TRUE(bigint_eq_bigint(squared, aliased));
+	EXPECT_TRUE(bigint_eq_bigint(squared, not_aliased));
+
+	// same numbers, but different signs
+	BigIntC negated = big_int_c;
+	bigint_negate(&negated);
+
+	BigIntC aliased_negative = bigint_mul_bigint(big_int_c, negated);
+	BigIntC not_aliased_negative = bigint_mul_bigint(other_c, negated);
+
+	EXPECT_FALSE(aliased_negative.positive);
+	EXPECT_TRUE(bigint_eq_bigint(aliased_negative, not_aliased_negative));
+
+	free_bigint(&big_int_c);
+	free_bigint(&other_c);
+	free_bigint(&squared);
+	free_bigint(&aliased);
+	free_bigint(&not_aliased);
+	free_bigint(&aliased_negative);
+	free_bigint(&not_aliased_negative);
+}
+
+TEST(BigIntCFuncs, LimbPrimitives) {
+
+	constexpr uint64_t max = 0xFFFFFFFFFFFFFFFFULL;
+
+	{ // add_n and sub_n propagate the carry / borrow through all numbers
+		const uint64_t numbers1[] = { max, max, 0x01ULL };
+		const uint64_t numbers2[] = { 0x01ULL, 0x00ULL, max };
+		uint64_t result[3] = {};
+
+		EXPECT_EQ(bigint_limbs_add_n(result, numbers1, numbers2, 3), 1ULL);
+		EXPECT_EQ(result[0], 0ULL);
+		EXPECT_EQ(result[1], 0ULL);
+		EXPECT_EQ(result[2], 0x01ULL);
+
+		EXPECT_EQ(bigint_limbs_sub_n(result, result, numbers2, 3), 1ULL);
+		EXPECT_EQ(result[0], max);
+		EXPECT_EQ(result[1], max);
+		EXPECT_EQ(result[2], 0x01ULL);
+	}
+
+	{ // add_1 and sub_1
+		uint64_t numbers[] = { max, max, 0x05ULL };
+
+		EXPECT_EQ(bigint_limbs_add_1(numbers, numbers, 3, 0x01ULL), 0ULL);
+		EXPECT_EQ(numbers[0], 0ULL);
+		EXPECT_EQ(numbers[1], 0ULL);
+		EXPECT_EQ(numbers[2], 0x06ULL);
+
+		uint64_t result[3] = {};
+		EXPECT_EQ(bigint_limbs_sub_1(result, numbers, 3, 0x02ULL), 0ULL);
+		EXPECT_EQ(result[0], max - 1);
+		EXPECT_EQ(result[1], max);
+		EXPECT_EQ(result[2], 0x05ULL);
+	}
+
+	{ // mul_1, addmul_1 and submul_1 are inverse to each other
+		const uint64_t numbers[] = { max, 0x1234ULL, max };
+		uint64_t result[3] = {};
+
+		const uint64_t high = bigint_limbs_mul_1(result, numbers, 3, max);
+		EXPECT_EQ(result[0], 0x01ULL);
+		EXPECT_EQ(high, max - 1);
+
+		uint64_t accumulated[3] = { 0x07ULL, 0x08ULL, 0x09ULL };
+		const uint64_t carry = bigint_limbs_addmul_1(accumulated, numbers, 3, max);
+		EXPECT_EQ(carry, high);
+		EXPECT_EQ(accumulated[0], 0x08ULL);
+
+		const uint64_t borrow = bigint_limbs_submul_1(accumulated, numbers, 3, max);
+		EXPECT_EQ(borrow, carry);
+		EXPECT_EQ(accumulated[0], 0x07ULL);
+		EXPECT_EQ(accumulated[1], 0x08ULL);
+		EXPECT_EQ(accumulated[2], 0x09ULL);
+	}
+
+	{ // lshift and rshift, in place
+		uint64_t numbers[] = { 0x8000000000000001ULL, 0xF000000000000000ULL };
+
+		EXPECT_EQ(bigint_limbs_lshift(numbers, numbers, 2, 4), 0x0FULL);
+		EXPECT_EQ(numbers[0], 0x10ULL);
+		EXPECT_EQ(numbers[1], 0x08ULL);
+
+		EXPECT_EQ(bigint_limbs_rshift(numbers, numbers, 2, 5), 0x8000000000000000ULL);
+		EXPECT_EQ(numbers[0], 0x4000000000000000ULL);
+		EXPECT_EQ(numbers[1], 0ULL);
+	}
+
+	{ // cmp and copy
+		const uint64_t numbers1[] = { 0x05ULL, 0x01ULL };
+		const uint64_t numbers2[] = { 0x04ULL, 0x02ULL };
+		uint64_t copied[2] = {};
+
+		EXPECT_EQ(bigint_limbs_cmp(numbers1, numbers2, 2), -1);
+		EXPECT_EQ(bigint_limbs_cmp(numbers2, numbers1, 2), 1);
+		EXPECT_EQ(bigint_limbs_cmp(numbers1, numbers2, 1), 1);
+
+		bigint_limbs_copy(copied, numbers1, 2);
+		EXPECT_EQ(bigint_limbs_cmp(copied, numbers1, 2), 0);
+	}
+}
+
+TEST(BigIntCFuncs, PrecomputedDivisor) {
+
+	const uint64_t dividend_numbers[] = { 0x8000000000000000ULL, 0x1234ULL, 0xFFFFFFFFFFFFFFFFULL,
+		                                  0x42ULL, 0x07ULL };
+
+	BigIntC dividend = bigint_from_list_of_numbers(dividend_numbers, 5);
+
+	for(const uint64_t divisor_number :
+	    { 1ULL, 3ULL, 10ULL, 10000000000000000000ULL, 0x8000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL }) {
+
+		const BigIntDivisorU64 divisor = bigint_divisor_u64_from_number(divisor_number);
+		BigIntC divisor_c = bigint_from_unsigned_number(divisor_number);
+
+		for(const bool positive : { true, false }) {
+
+			dividend.positive = positive;
+
+			BigIntDivModC expected = bigint_divmod(dividend, divisor_c);
+			BigIntDivModU64C result = bigint_divmod_u64_pre(dividend, divisor);
+
+			EXPECT_TRUE(bigint_eq_bigint(result.quotient, expected.quotient));
+			EXPECT_EQ(result.quotient.positive, expected.quotient.positive);
+
+			expected.remainder.positive = true;
+			EXPECT_TRUE(bigint_eq_u64(expected.remainder, result.remainder));
+			EXPECT_EQ(bigint_mod_u64_pre(dividend, divisor), result.remainder);
+
+			free_bigint(&expected.quotient);
+			free_bigint(&expected.remainder);
+			free_bigint(&result.quotient);
+		}
+
+		free_bigint(&divisor_c);
+	}
+
+	{ // the limb level function works in place
+		uint64_t numbers[] = { 25ULL, 0ULL, 5ULL };
+
+		const uint64_t remainder =
+		    bigint_limbs_divrem_1_pre(numbers, numbers, 3, bigint_divisor_u64_from_number(5ULL));
+
+		EXPECT_EQ(remainder, 0ULL);
+		EXPECT_EQ(numbers[0], 5ULL);
+		EXPECT_EQ(numbers[1], 0ULL);
+		EXPECT_EQ(numbers[2], 1ULL);
+	}
+
+	dividend.positive = true;
+	free_bigint(&dividend);
+}
+
+TEST(BigIntCFuncs, MontgomeryContextReuse) {
+
+	// the most significant number comes first
+	const uint64_t modulus_numbers[] = { 0x8000000000000000ULL, 0x1234ULL, 0xFFFFFFFFFFFFFFC5ULL };
+
+	BigIntC modulus = bigint_from_list_of_numbers(modulus_numbers, 3);
+
+	BigIntMontCtx ctx = bigint_mont_ctx_from_modulus(modulus);
+
+	// the same context gives the same results as a fresh one for every call
+	for(const uint64_t base_number : { 0ULL, 2ULL, 3ULL, 0xFFFFFFFFFFFFFFFFULL }) {
+
+		BigIntC base = bigint_from_unsigned_number(base_number);
+
+		for(const uint64_t exponent_number : { 0ULL, 1ULL, 65537ULL, 0xFFFFFFFFFFFFFFFFULL }) {
+
+			BigIntC exponent = bigint_from_unsigned_number(exponent_number);
+
+			BigIntC expected = bigint_powm(base, exponent, modulus);
+			BigIntC result = bigint_powm_mont(base, exponent, &ctx);
+
+			EXPECT_TRUE(bigint_eq_bigint(result, expected));
+			EXPECT_TRUE(result.positive);
+
+			free_bigint(&exponent);
+			free_bigint(&expected);
+			free_bigint(&result);
+		}
+
+		free_bigint(&base);
+	}
+
+	{ // fermat: 2^(p - 1) mod p = 1 for the prime p = 2^64 - 59
+		BigIntC prime = bigint_from_unsigned_number(0xFFFFFFFFFFFFFFC5ULL);
+		BigIntC exponent = bigint_from_unsigned_number(0xFFFFFFFFFFFFFFC4ULL);
+		BigIntC base = bigint_from_unsigned_number(2ULL);
+
+		BigIntMontCtx prime_ctx = bigint_mont_ctx_from_modulus(prime);
+		BigIntC result = bigint_powm_mont(base, exponent, &prime_ctx);
+
+		EXPECT_TRUE(bigint_eq_u64(result, 1ULL));
+
+		free_bigint(&result);
+		free_bigint_mont_ctx(&prime_ctx);
+		free_bigint(&base);
+		free_bigint(&exponent);
+		free_bigint(&prime);
+	}
+
+	free_bigint_mont_ctx(&ctx);
+	free_bigint_mont_ctx(nullptr);
+
+	EXPECT_EQ(ctx.scratch, nullptr);
+
+	free_bigint(&modulus);
+}
+
+TEST(BigIntCFuncs, FixedBaseExponentiation) {
+
+	// the most significant number comes first
+	const uint64_t modulus_numbers[] = { 0x8000000000000000ULL, 0x1234ULL, 0x42ULL,
+		                                 0xFFFFFFFFFFFFFFC5ULL };
+	const uint64_t base_numbers[] = { 0x07ULL, 0x1234567890ABCDEFULL, 0x2ULL, 0x3ULL, 0x4ULL };
+	const uint64_t exponent_numbers[] = { 0xFEDCBA9876543210ULL, 0x0123456789ABCDEFULL,
+		                                  0x5555555555555555ULL };
+
+	BigIntC modulus = bigint_from_list_of_numbers(modulus_numbers, 4);
+
+	for(const bool positive : { true, false }) {
+
+		// the base is greater than the modulus
+		BigIntC base = bigint_from_list_of_numbers(base_numbers, 5);
+		base.positive = positive;
+
+		// the budget is too small for more than one tooth, fits several and more than the bits
+		for(const size_t budget : { size_t{ 0 }, size_t{ 4096 }, size_t{ 1 } << 20 }) {
+
+			BigIntFixedBaseCtx ctx = bigint_fixed_base_ctx_from(base, modulus, 128, budget);
+
+			for(size_t exponent_count = 0; exponent_count <= 3; ++exponent_count) {
+
+				// 0, exactly 64 and 128 bits and more bits than the table covers
+				BigIntC exponent =
+				    exponent_count == 0
+				        ? bigint_from_unsigned_number(0ULL)
+				        : bigint_from_list_of_numbers(exponent_numbers + (3 - exponent_count),
+				                                      exponent_count);
+
+				BigIntC expected = bigint_powm(base, exponent, modulus);
+				BigIntC result = bigint_powm_fixed_base(exponent, &ctx);
+
+				EXPECT_TRUE(bigint_eq_bigint(result, expected))
+				    << "budget: " << budget << ", exponent numbers: " << exponent_count;
+
+				// the context stays valid
+				BigIntC again = bigint_powm_fixed_base(exponent, &ctx);
+				EXPECT_TRUE(bigint_eq_bigint(again, expected));
+
+				free_bigint(&exponent);
+				free_bigint(&expected);
+				free_bigint(&result);
+				free_bigint(&again);
+			}
+
+			free_bigint_fixed_base_ctx(&ctx);
+		}
+
+		free_bigint(&base);
+	}
+
+	free_bigint(&modulus);
+}
+
+TEST(BigIntCFuncs, MultiExponentiation) {
+
+	BigIntC modulus = random_bigint_c(4, 42, true);
+	modulus.numbers[0] |= 0x01;
+
+	BigIntMontCtx ctx = bigint_mont_ctx_from_modulus(modulus);
+
+	// no bases, a few with interleaved windows and enough for the buckets
+	for(const size_t count : { 0, 1, 3, 40, 128, 300 }) {
+
+		std::vector<BigIntC> bases{};
+		std::vector<BigIntC> exponents{};
+
+		for(size_t i = 0; i < count; ++i) {
+			// the bases are greater than the modulus or negative, the exponents have different
+			// lengths, some of them are 0
+			bases.push_back(random_bigint_c((i % 5) + 1, (count * 1000) + i, i % 3 != 0));
+			exponents.push_back(i % 7 == 3 ? bigint_from_unsigned_number(0ULL)
+			                               : random_bigint_c((i % 4) + 1, (count * 2000) + i, true));
+		}
+
+		BigIntC expected = bigint_from_unsigned_number(1ULL);
+
+		for(size_t i = 0; i < count; ++i) {
+			BigIntC power = bigint_powm(bases[i], exponents[i], modulus);
+			BigIntC product = bigint_mul_bigint(expected, power);
+			BigIntC reduced = bigint_mod_floor(product, modulus);
+
+			free_bigint(&expected);
+			expected = reduced;
+
+			free_bigint(&power);
+			free_bigint(&product);
+		}
+
+		BigIntC result = bigint_multi_powm(bases.data(), exponents.data(), count, &ctx);
+
+		EXPECT_TRUE(bigint_eq_bigint(result, expected)) << "count: " << count;
+
+		free_bigint(&expected);
+		free_bigint(&result);
+
+		for(size_t i = 0; i < count; ++i) {
+			free_bigint(&bases[i]);
+			free_bigint(&exponents[i]);
+		}
+	}
+
+	free_bigint_mont_ctx(&ctx);
+	free_bigint(&modulus);
+}
+
+TEST(BigIntCFuncs, BarrettReduction) {
+
+	std::vector<BigIntC> moduli{};
+
+	for(const size_t size : { 1, 2, 3, 20, 40 }) {
+		moduli.push_back(random_bigint_c(size, size * 37, true));
+	}
+
+	// even moduli and the powers of 2^64, which have the largest reciprocal
+	const uint64_t even_numbers[] = { 0x42ULL, 0x1234ULL };
+	const uint64_t power_numbers[] = { 0x01ULL, 0x00ULL, 0x00ULL, 0x00ULL, 0x00ULL };
+
+	moduli.push_back(bigint_from_list_of_numbers(even_numbers, 2));
+	moduli.push_back(bigint_from_list_of_numbers(power_numbers, 1));
+	moduli.push_back(bigint_from_list_of_numbers(power_numbers, 2));
+	moduli.push_back(bigint_from_list_of_numbers(power_numbers, 5));
+
+	for(BigIntC& modulus : moduli) {
+
+		BigIntBarrettCtx ctx = bigint_barrett_ctx_from_modulus(modulus);
+
+		const size_t size = modulus.number_count;
+
+		for(const bool positive : { true, false }) {
+			// less numbers than the modulus, one reduction and several blocks
+			for(const size_t value_size : { size_t{ 1 }, size, 2 * size, (5 * size) + 1 }) {
+
+				BigIntC value = random_bigint_c(value_size, value_size * 41, positive);
+				BigIntC factor = random_bigint_c(size, size * 43, true);
+
+				BigIntC expected = bigint_mod_floor(value, modulus);
+				BigIntC result = bigint_mod_barrett(value, &ctx);
+
+				EXPECT_TRUE(bigint_eq_bigint(result, expected));
+
+				BigIntC product = bigint_mul_bigint(value, factor);
+				BigIntC expected_product = bigint_mod_floor(product, modulus);
+				BigIntC result_product = bigint_mulmod_barrett(value, factor, &ctx);
+
+				EXPECT_TRUE(bigint_eq_bigint(result_product, expected_product));
+
+				free_bigint(&value);
+				free_bigint(&factor);
+				free_bigint(&expected);
+				free_bigint(&result);
+				free_bigint(&product);
+				free_bigint(&expected_product);
+				free_bigint(&result_product);
+			}
+		}
+
+		free_bigint_barrett_ctx(&ctx);
+		free_bigint(&modulus);
+	}
+}
+
+TEST(BigIntCFuncs, SpecialFormReduction) {
+
+	{ // a random modulus doesn't have the form, 2^64 + 1 is more than a power of two
+		BigIntC modulus = random_bigint_c(3, 3, true);
+		EXPECT_FALSE(bigint_is_special_modulus(modulus));
+		free_bigint(&modulus);
+
+		const uint64_t power_numbers[] = { 0x01ULL, 0x01ULL };
+		BigIntC above = bigint_from_list_of_numbers(power_numbers, 2);
+		EXPECT_FALSE(bigint_is_special_modulus(above));
+		free_bigint(&above);
+	}
+
+	// mersenne numbers, pseudo mersenne numbers and a power of two
+	const std::vector<std::pair<size_t, uint64_t>> forms = {
+		{ 61, 1ULL },  { 64, 0ULL },   { 127, 1ULL }, { 255, 19ULL }, { 256, 0x1000003D1ULL },
+		{ 521, 1ULL },
+	};
+
+	for(const auto& [bits, offset] : forms) {
+
+		BigIntSpecialCtx ctx = bigint_special_ctx_from_form(bits, offset);
+
+		const BigIntC modulus = ctx.modulus;
+
+		{ // the form is detected from the modulus
+			EXPECT_TRUE(bigint_is_special_modulus(modulus));
+
+			BigIntSpecialCtx detected = bigint_special_ctx_from_modulus(modulus);
+			EXPECT_EQ(detected.bits, bits);
+			EXPECT_EQ(detected.offset, offset);
+			free_bigint_special_ctx(&detected);
+		}
+
+		const size_t size = modulus.number_count;
+
+		for(const bool positive : { true, false }) {
+			// less numbers than the modulus, one reduction and several blocks
+			for(const size_t value_size : { size_t{ 1 }, size, 2 * size, (5 * size) + 1 }) {
+
+				BigIntC value = random_bigint_c(value_size, (value_size * 41) + bits, positive);
+				BigIntC factor = random_bigint_c(size, (size * 43) + bits, true);
+
+				BigIntC expected = bigint_mod_floor(value, modulus);
+				BigIntC result = bigint_mod_special(value, &ctx);
+
+				EXPECT_TRUE(bigint_eq_bigint(result, expected)) << "bits: " << bits;
+
+				BigIntC product = bigint_mul_bigint(value, factor);
+				BigIntC expected_product = bigint_mod_floor(product, modulus);
+				BigIntC result_product = bigint_mulmod_special(value, factor, &ctx);
+
+				EXPECT_TRUE(bigint_eq_bigint(result_product, expected_product));
+
+				BigIntC exponent = bigint_from_unsigned_number(5ULL);
+				BigIntC power = bigint_pow_u64(value, 5);
+				BigIntC expected_power = bigint_mod_floor(power, modulus);
+				BigIntC result_power = bigint_powm_special(value, exponent, &ctx);
+
+				EXPECT_TRUE(bigint_eq_bigint(result_power, expected_power));
+
+				free_bigint(&value);
+				free_bigint(&factor);
+				free_bigint(&expected);
+				free_bigint(&result);
+				free_bigint(&product);
+				free_bigint(&expected_product);
+				free_bigint(&result_product);
+				free_bigint(&exponent);
+				free_bigint(&power);
+				free_bigint(&expected_power);
+				free_bigint(&result_power);
+			}
+		}
+
+		{ // m - 1 squared needs the most foldings, the result is 1
+			BigIntC predecessor = bigint_sub_u64(modulus, 1);
+			BigIntC result = bigint_mulmod_special(predecessor, predecessor, &ctx);
+
+			EXPECT_TRUE(bigint_eq_u64(result, 1ULL));
+
+			free_bigint(&predecessor);
+			free_bigint(&result);
+		}
+
+		free_bigint_special_ctx(&ctx);
+	}
+}
+
+TEST(BigIntCFuncs, ProductTree) {
+
+	// no values, one value, values of the same size and of very different sizes, with a 0
+	for(const size_t count : { 0, 1, 2, 7, 64, 300 }) {
+
+		std::vector<BigIntC> values{};
+
+		for(size_t i = 0; i < count; ++i) {
+			const size_t size = i % 11 == 5 ? (i * 3) + 1 : (count % 3) + 1;
+
+			if(count == 64 && i == 40) {
+				values.push_back(bigint_from_unsigned_number(0ULL));
+				continue;
+			}
+
+			values.push_back(random_bigint_c(size, (count * 1000) + i, i % 3 != 0));
+		}
+
+		BigIntC expected = bigint_from_unsigned_number(1ULL);
+
+		for(size_t i = 0; i < count; ++i) {
+			BigIntC product = bigint_mul_bigint(expected, values[i]);
+
+			free_bigint(&expected);
+			expected = product;
+		}
+
+		BigIntC result = bigint_product(values.data(), count);
+
+		EXPECT_TRUE(bigint_eq_bigint(result, expected)) << "count: " << count;
+
+		free_bigint(&result);
+
+		if(count != 0) {
+			BigIntProductTree tree = bigint_product_tree(values.data(), count);
+
+			EXPECT_TRUE(bigint_eq_bigint(tree.nodes[(2 * count) - 2], expected))
+			    << "count: " << count;
+
+			for(size_t i = 0; i < count; ++i) {
+				EXPECT_TRUE(bigint_eq_bigint(tree.nodes[i], values[i])) << "count: " << count;
+			}
+
+			// every inner node is the product of its children, that come before it
+			for(size_t i = count; i < (2 * count) - 1; ++i) {
+				const size_t left = tree.children[2 * (i - count)];
+				const size_t right = tree.children[(2 * (i - count)) + 1];
+
+				ASSERT_LT(left, i);
+				ASSERT_LT(right, i);
+
+				BigIntC product = bigint_mul_bigint(tree.nodes[left], tree.nodes[right]);
+
+				EXPECT_TRUE(bigint_eq_bigint(tree.nodes[i], product)) << "count: " << count;
+
+				free_bigint(&product);
+			}
+
+			free_bigint_product_tree(&tree);
+			free_bigint_product_tree(&tree);
+		}
+
+		free_bigint(&expected);
+
+		for(size_t i = 0; i < count; ++i) {
+			free_bigint(&values[i]);
+		}
+	}
+}
+
 // TODO: input invalid BigInts into all public functions an see how the behave, make the behavior
 // expected, e.g. that negate doesn't care about the amount or numbers being NULL, or that it does
 // care